@@ -1,233 +1,312 @@
 #include <iostream>
-#include "./lib/matrix.h"
+#include "./lib/ackermann.h"
+#include "./lib/benchmark.h"
+#include "./lib/perf.h"
 
-#define NOT_COMPUTED -1 
-#define INVALID_VALUE -2 
-
-static MatrixList* table = NULL;
-
-bool init_ackermann_table(int32_t max_m, int32_t max_n) {
-    if (table != NULL) {
-        delete_matrix(table);
-    }
-    
-    table = new_matrix(max_m + 1, max_n + 1);
-    if (table == NULL) {
-        return false;
-    }
-    
-    fill_matrix(table, NOT_COMPUTED);
-    
-    return true;
-}
-
-void cleanup_ackermann_table() {
-    if (table != NULL) {
-        delete_matrix(table);
-        table = NULL;
-    }
-}
-
-bool is_in_table_range(int32_t m, int32_t n) {
-    if (table == NULL) {
-        return false;
-    }
-
-    return (m >= 0 && n >= 0 && m < table->rows && n < table->cols);
-}
-
-int32_t get_from_table(int32_t m, int32_t n) {
-    if (!is_in_table_range(m, n)) {
-        return NOT_COMPUTED;
-    }
-
-    return get_matrix(table, m, n);
-}
-
-void store_to_table(int32_t m, int32_t n, int32_t value) {
-    if (table == NULL) {
+void calculate(int32_t m, int32_t n) {
+    if (m < 0 || n < 0) {
+        printf("A(%d, %d) = invalid input\n", m, n);
         return;
     }
     
-    if (m >= table->rows || n >= table->cols) {
-        int32_t new_rows = (m >= table->rows) ? m + 10 : table->rows;
-        int32_t new_cols = (n >= table->cols) ? n + 1000 : table->cols;
-        
-        extend_matrix(table, new_rows, new_cols);
-        
-        for (int32_t i = 0; i < new_rows; ++i) {
-            for (int32_t j = 0; j < new_cols; ++j) {
-                if (get_matrix(table, i, j) == 0) {
-                    set_matrix(table, i, j, NOT_COMPUTED);
-                }
-            }
-        }
-    }
-    
-    if (is_in_table_range(m, n)) {
-        set_matrix(table, m, n, value);
-    }
-}
-
-int32_t ackermann_function_memoization(int32_t m, int32_t n) {
-    if (m < 0 || n < 0) {
-        return INVALID_VALUE;
-    }
-
-    int32_t cached_value = get_from_table(m, n);
-    if (cached_value != NOT_COMPUTED) {
+    BenchTimer timer;
+    PerfSample sample;
+    AllocStats alloc;
+    PerfCounters* perf = new_perf_counters();
 
-        return cached_value;
-    }
-    
-    int32_t result;
+    printf("Closed-form version:\n");
+    BigInt* result_closed_form = new_bigint(0);
+    reset_alloc_stats();
+    start_perf_counters(perf);
+    start_timer(&timer);
+    bool closed_form_ok = ackermann_function_closed_form(m, n, result_closed_form);
+    stop_timer(&timer);
+    stop_perf_counters(perf, &sample);
+    alloc = get_alloc_stats();
     
-    if (m == 0) {
-        result = n + 1;
-    } else if (m > 0 && n == 0) {
-        result = ackermann_function_memoization(m - 1, 1);
+    if (closed_form_ok) {
+        print_bigint_result(result_closed_form);
     } else {
-        result = ackermann_function_memoization(m - 1, ackermann_function_memoization(m, n - 1));
+        printf("Result: not representable\n");
     }
+    printf("Time: %f sec (wall), %f sec (cpu)\n", timer.wall, timer.cpu);
+    print_perf_sample(perf, &sample);
+    print_alloc_stats(&alloc);
 
-    store_to_table(m, n, result);
-    
-    return result;
-}
-
-int32_t ackermann_function_recursion(int32_t m, int32_t n) {
-    if (m == 0) {
-        return n + 1;
-    } else if (m > 0 && n == 0) {
-        return ackermann_function_recursion(m - 1, 1);
-    } else {
-        return ackermann_function_recursion(m - 1, ackermann_function_recursion(m, n - 1));
-    }
-}
+    printf("\n");
 
-int32_t ackermann_function_iterative(int32_t m, int32_t n) {
-    if (m < 0 || n < 0) {
-        return INVALID_VALUE;
-    }
-    
-    const int32_t MAX_STACK_SIZE = 2147483647;
-    
-    int32_t* m_stack = (int32_t*)malloc(sizeof(int32_t) * MAX_STACK_SIZE);
-    int32_t* n_stack = (int32_t*)malloc(sizeof(int32_t) * MAX_STACK_SIZE);
+    int64_t expected = 0;
+    bool fits = closed_form_ok && bigint_to_int64(result_closed_form, &expected) && expected <= INT32_MAX;
+    delete_bigint(result_closed_form);
     
-    if (m_stack == NULL || n_stack == NULL) {
-        if (m_stack) free(m_stack);
-        if (n_stack) free(n_stack);
-        return INVALID_VALUE;
-    }
-    
-    int32_t stack_top = 0;
-    
-    m_stack[stack_top] = m;
-    n_stack[stack_top] = n;
-    ++stack_top;
-    
-    int32_t result = 0;
-    
-    while (stack_top > 0) {
-        if (stack_top >= MAX_STACK_SIZE - 2) {
-            free(m_stack);
-            free(n_stack);
-            return INVALID_VALUE;
-        }
-        
-        --stack_top;
-        int32_t curr_m = m_stack[stack_top];
-        int32_t curr_n = n_stack[stack_top];
-        
-        if (curr_m == 0) {
-            result = curr_n + 1;
-            
-            if (stack_top > 0) {
-                n_stack[stack_top - 1] = result;
-            }
-        } else if (curr_n == 0) {
-            m_stack[stack_top] = curr_m - 1;
-            n_stack[stack_top] = 1;
-            ++stack_top;
-        } else {
-            m_stack[stack_top] = curr_m - 1;
-            n_stack[stack_top] = -1;
-            ++stack_top;
-            
-            m_stack[stack_top] = curr_m;
-            n_stack[stack_top] = curr_n - 1;
-            ++stack_top;
-        }
+    if (!fits) {
+        printf("Result exceeds int32_t, skipping recursive, memoization and iterative versions\n");
+        delete_perf_counters(perf);
+        return;
     }
-    
-    free(m_stack);
-    free(n_stack);
-    
-    return result;
-}
-
-void calculate(int32_t m, int32_t n) {
-    clock_t start, end;
-    double cpu_time_used;
 
     printf("Memoization version:\n");
-    start = clock();
+    reset_memo_stats();
+    reset_alloc_stats();
+    start_perf_counters(perf);
+    start_timer(&timer);
     int32_t result_memoization = ackermann_function_memoization(m, n);
-    end = clock();
-    cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+    stop_timer(&timer);
+    stop_perf_counters(perf, &sample);
+    alloc = get_alloc_stats();
 
     printf("Result: %d\n", result_memoization);
-    printf("Time: %f sec\n", cpu_time_used);
+    printf("Time: %f sec (wall), %f sec (cpu)\n", timer.wall, timer.cpu);
+    print_perf_sample(perf, &sample);
+    print_alloc_stats(&alloc);
+    print_memo_stats();
 
     printf("\n");
 
     printf("Recursion version:\n");
-    start = clock();
+    reset_alloc_stats();
+    start_perf_counters(perf);
+    start_timer(&timer);
     int32_t result_recursion = ackermann_function_recursion(m, n);
-    end = clock();
-    cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+    stop_timer(&timer);
+    stop_perf_counters(perf, &sample);
+    alloc = get_alloc_stats();
     printf("Result: %d\n", result_recursion);
-    printf("Time: %f sec\n", cpu_time_used);
+    printf("Time: %f sec (wall), %f sec (cpu)\n", timer.wall, timer.cpu);
+    print_perf_sample(perf, &sample);
+    print_alloc_stats(&alloc);
 
     printf("\n");
 
     printf("Iterative version:\n");
-    start = clock();
+    reset_alloc_stats();
+    start_perf_counters(perf);
+    start_timer(&timer);
     int32_t result_iterative = ackermann_function_iterative(m, n);
-    end = clock();
-    cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
+    stop_timer(&timer);
+    stop_perf_counters(perf, &sample);
+    alloc = get_alloc_stats();
     printf("Result: %d\n", result_iterative);
-    printf("Time: %f sec\n", cpu_time_used);
+    printf("Time: %f sec (wall), %f sec (cpu)\n", timer.wall, timer.cpu);
+    print_perf_sample(perf, &sample);
+    print_alloc_stats(&alloc);
 
     printf("\n");
 
     if (result_memoization == result_recursion && 
         result_memoization == result_iterative && 
-        result_recursion == result_iterative
+        result_recursion == result_iterative &&
+        result_memoization == expected
     ) {
         printf("Consistent results\n");
     } else {
         printf("Inconsistent results!\n");
     }
+    
+    delete_perf_counters(perf);
 }
 
 
-int main() {
-    if (!init_ackermann_table(5, 21)) {
-        return 1;
+typedef struct {
+    int32_t m;
+    int32_t n;
+    int32_t result;
+    bool fits;
+    double latency;
+} BatchQuery;
+
+static int compare_batch_order(const void* a, const void* b) {
+    const BatchQuery* x = *(const BatchQuery* const*)a;
+    const BatchQuery* y = *(const BatchQuery* const*)b;
+    if (x->m != y->m) {
+        return (x->m > y->m) - (x->m < y->m);
+    }
+    return (x->n > y->n) - (x->n < y->n);
+}
+
+static BatchQuery* read_batch_queries(FILE* input, int32_t* count) {
+    int32_t capacity = 64;
+    BatchQuery* queries = (BatchQuery*)malloc_array(capacity, sizeof(BatchQuery));
+    *count = 0;
+    if (queries == NULL) {
+        return NULL;
     }
+    
     int32_t m = 0, n = 0;
+    while (fscanf(input, "%d %d", &m, &n) == 2) {
+        if (*count == capacity) {
+            if (capacity > INT32_MAX / 2) {
+                break;
+            }
+            BatchQuery* grown = (BatchQuery*)realloc_array(queries, (int64_t)capacity * 2, sizeof(BatchQuery));
+            if (grown == NULL) {
+                break;
+            }
+            queries = grown;
+            capacity *= 2;
+        }
+        
+        queries[*count].m = m;
+        queries[*count].n = n;
+        queries[*count].result = INVALID_VALUE;
+        queries[*count].fits = false;
+        queries[*count].latency = 0;
+        ++*count;
+    }
+    
+    return queries;
+}
 
-    printf("Enter m and n: ");
+static bool fits_in_int32(int32_t m, int32_t n, BigInt* scratch) {
+    int64_t value = 0;
+    return ackermann_function_closed_form(m, n, scratch)
+        && bigint_to_int64(scratch, &value)
+        && value <= INT32_MAX;
+}
 
-    if (scanf("%d %d", &m, &n) != 2) {
-        printf("Input error!\n");
-        cleanup_ackermann_table();
+static int run_batch(FILE* input) {
+    int32_t count = 0;
+    BatchQuery* queries = read_batch_queries(input, &count);
+    BatchQuery** order = (BatchQuery**)malloc_array(count, sizeof(BatchQuery*));
+    double* latencies = (double*)malloc_array(count, sizeof(double));
+    BigInt* scratch = new_bigint(0);
+    
+    if (queries == NULL || order == NULL || latencies == NULL || scratch == NULL) {
+        printf("Out of memory\n");
+        tracked_free(queries);
+        tracked_free(order);
+        tracked_free(latencies);
+        delete_bigint(scratch);
         return 1;
     }
     
-    calculate(m, n);
-    cleanup_ackermann_table();
+    for (int32_t i = 0; i < count; ++i) {
+        order[i] = &queries[i];
+    }
+    qsort(order, count, sizeof(BatchQuery*), compare_batch_order);
+    
+    BenchTimer total;
+    BenchTimer timer;
+    start_timer(&total);
+    
+    for (int32_t i = 0; i < count; ++i) {
+        BatchQuery* query = order[i];
+        start_timer(&timer);
+        query->fits = query->m >= 0 && query->n >= 0 && fits_in_int32(query->m, query->n, scratch);
+        if (query->fits) {
+            query->result = ackermann_function_memoization(query->m, query->n);
+        }
+        stop_timer(&timer);
+        query->latency = timer.wall;
+    }
+    
+    stop_timer(&total);
+    
+    for (int32_t i = 0; i < count; ++i) {
+        if (queries[i].fits) {
+            printf("A(%d, %d) = %d (%f sec)\n", queries[i].m, queries[i].n, queries[i].result, queries[i].latency);
+        } else if (queries[i].m < 0 || queries[i].n < 0) {
+            printf("A(%d, %d) = invalid input\n", queries[i].m, queries[i].n);
+        } else {
+            printf("A(%d, %d) exceeds int32_t (%f sec)\n", queries[i].m, queries[i].n, queries[i].latency);
+        }
+        latencies[i] = queries[i].latency;
+    }
+    
+    printf("\n");
+    printf("Queries: %d\n", count);
+    printf("Total time: %f sec (wall), %f sec (cpu)\n", total.wall, total.cpu);
+    
+    if (count > 0) {
+        sort_samples(latencies, count);
+        printf("Throughput: %f queries/sec\n", total.wall > 0 ? count / total.wall : 0.0);
+        printf("Latency: min %f, median %f, p95 %f, max %f sec\n",
+               latencies[0],
+               sample_percentile(latencies, count, 0.5),
+               sample_percentile(latencies, count, 0.95),
+               latencies[count - 1]);
+    }
+    print_memo_stats();
+    
+    tracked_free(queries);
+    tracked_free(order);
+    tracked_free(latencies);
+    delete_bigint(scratch);
     return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char** argv) {
+    const char* memo_path = NULL;
+    const char* batch_path = NULL;
+    bool batch = false;
+    MemoBackend backend = MEMO_HASH;
+    
+    for (int32_t i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--batch") == 0) {
+            batch = true;
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) {
+                batch_path = argv[++i];
+            }
+        } else if (strncmp(argv[i], "--memo=", 7) == 0) {
+            const char* name = argv[i] + 7;
+            if (strcmp(name, "dense") == 0) {
+                backend = MEMO_DENSE;
+            } else if (strcmp(name, "hash") == 0) {
+                backend = MEMO_HASH;
+            } else if (strcmp(name, "concurrent") == 0) {
+                backend = MEMO_CONCURRENT;
+            } else {
+                printf("Unknown memo backend: %s\n", name);
+                return 1;
+            }
+        } else {
+            memo_path = argv[i];
+        }
+    }
+    
+    if (memo_path != NULL && backend != MEMO_DENSE) {
+        printf("Memo path %s requires --memo=dense\n", memo_path);
+        return 1;
+    }
+    
+    if (memo_path != NULL && load_ackermann_table(memo_path)) {
+        printf("Loaded memo table from %s\n", memo_path);
+    } else if (!init_ackermann_table(5, 21, backend)) {
+        return 1;
+    }
+    
+    int status = 0;
+    
+    if (batch) {
+        FILE* input = (batch_path != NULL) ? fopen(batch_path, "r") : stdin;
+        if (input == NULL) {
+            printf("Cannot open %s\n", batch_path);
+            cleanup_ackermann_table();
+            return 1;
+        }
+        
+        status = run_batch(input);
+        if (input != stdin) {
+            fclose(input);
+        }
+    } else {
+        int32_t m = 0, n = 0;
+
+        printf("Enter m and n: ");
+
+        if (scanf("%d %d", &m, &n) != 2) {
+            printf("Input error!\n");
+            cleanup_ackermann_table();
+            return 1;
+        }
+        
+        calculate(m, n);
+    }
+    
+    if (memo_path != NULL && !save_ackermann_table(memo_path)) {
+        printf("Failed to save memo table to %s\n", memo_path);
+    }
+    
+    cleanup_ackermann_table();
+    return status;
+}
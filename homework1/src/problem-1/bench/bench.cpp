@@ -0,0 +1,106 @@
+#include "../lib/ackermann.h"
+#include "../lib/benchmark.h"
+
+typedef struct {
+    int32_t m;
+    int32_t n;
+    MemoBackend backend;
+    int32_t result;
+    BigInt* big_result;
+} AckermannCase;
+
+static void reset_memo(void* context) {
+    AckermannCase* c = (AckermannCase*)context;
+    init_ackermann_table(5, 21, c->backend);
+}
+
+static void run_memoization(void* context) {
+    AckermannCase* c = (AckermannCase*)context;
+    c->result = ackermann_function_memoization(c->m, c->n);
+}
+
+static void run_recursion(void* context) {
+    AckermannCase* c = (AckermannCase*)context;
+    c->result = ackermann_function_recursion(c->m, c->n);
+}
+
+static void run_iterative(void* context) {
+    AckermannCase* c = (AckermannCase*)context;
+    c->result = ackermann_function_iterative(c->m, c->n);
+}
+
+static void run_closed_form(void* context) {
+    AckermannCase* c = (AckermannCase*)context;
+    ackermann_function_closed_form(c->m, c->n, c->big_result);
+}
+
+static bool check_memo_bound() {
+    HashTable* memo = new_hash_table(MIN_HASH_CAPACITY, MAX_MEMO_ENTRIES);
+    if (memo == NULL) {
+        return false;
+    }
+    
+    int64_t peak = 0;
+    for (int64_t key = 0; key < (int64_t)MAX_MEMO_ENTRIES * 2; ++key) {
+        hash_table_put(memo, (uint64_t)key, (int32_t)key);
+        if (memo->size > peak) {
+            peak = memo->size;
+        }
+    }
+    delete_hash_table(memo);
+    
+    if (peak > MAX_MEMO_ENTRIES) {
+        fprintf(stderr, "Memo bound exceeded: %lld entries, limit %d\n", (long long)peak, MAX_MEMO_ENTRIES);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config = default_bench_config();
+    if (!parse_bench_args(argc, argv, &config)) {
+        return 1;
+    }
+    
+    if (!check_memo_bound()) {
+        return 1;
+    }
+    
+    const int32_t sweep[][2] = {
+        {1, 1000}, {2, 500}, {3, 4}, {3, 6}, {3, 8}
+    };
+    const int32_t sweep_size = sizeof(sweep) / sizeof(sweep[0]);
+    
+    BenchReport* report = new_bench_report();
+    AckermannCase c;
+    c.big_result = new_bigint(0);
+    if (report == NULL || c.big_result == NULL) {
+        return 1;
+    }
+    
+    for (int32_t i = 0; i < sweep_size; ++i) {
+        char params[BENCH_NAME_LENGTH];
+        c.m = sweep[i][0];
+        c.n = sweep[i][1];
+        snprintf(params, sizeof(params), "m=%d n=%d", c.m, c.n);
+        
+        c.backend = MEMO_HASH;
+        add_bench_result(report, run_benchmark("ackermann_memo_hash", params, reset_memo, run_memoization, NULL, &c, config));
+        c.backend = MEMO_DENSE;
+        add_bench_result(report, run_benchmark("ackermann_memo_dense", params, reset_memo, run_memoization, NULL, &c, config));
+        add_bench_result(report, run_benchmark("ackermann_recursive", params, NULL, run_recursion, NULL, &c, config));
+        add_bench_result(report, run_benchmark("ackermann_iterative", params, NULL, run_iterative, NULL, &c, config));
+        add_bench_result(report, run_benchmark("ackermann_closed_form", params, NULL, run_closed_form, NULL, &c, config));
+    }
+    
+    c.m = 4;
+    c.n = 2;
+    add_bench_result(report, run_benchmark("ackermann_closed_form", "m=4 n=2", NULL, run_closed_form, NULL, &c, config));
+    
+    bool written = write_bench_report(report, config);
+    
+    cleanup_ackermann_table();
+    delete_bigint(c.big_result);
+    delete_bench_report(report);
+    return written ? 0 : 1;
+}
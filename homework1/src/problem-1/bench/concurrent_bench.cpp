@@ -0,0 +1,129 @@
+#include <thread>
+#include <vector>
+#include "../lib/ackermann.h"
+#include "../lib/benchmark.h"
+
+#define QUERY_COUNT 65536
+
+typedef struct {
+    int32_t m;
+    int32_t n;
+} AckermannQuery;
+
+typedef struct {
+    AckermannQuery queries[QUERY_COUNT];
+    MemoBackend backend;
+    int32_t thread_count;
+    std::atomic<int64_t> checksum;
+} ConcurrentCase;
+
+static void build_queries(ConcurrentCase* c) {
+    uint32_t state = 12345;
+    for (int32_t i = 0; i < QUERY_COUNT; ++i) {
+        state = state * 1664525u + 1013904223u;
+        int32_t m = 1 + (int32_t)((state >> 8) % 3);
+        int32_t n = (m == 3) ? (int32_t)((state >> 12) % 9) : (int32_t)((state >> 12) % 2000);
+        c->queries[i].m = m;
+        c->queries[i].n = n;
+    }
+}
+
+static void reset_memo(void* context) {
+    ConcurrentCase* c = (ConcurrentCase*)context;
+    init_ackermann_table(5, 21, c->backend);
+    c->checksum.store(0);
+}
+
+static void answer_queries(ConcurrentCase* c, int32_t begin, int32_t step) {
+    int64_t checksum = 0;
+    for (int32_t i = begin; i < QUERY_COUNT; i += step) {
+        checksum += ackermann_function_memoization(c->queries[i].m, c->queries[i].n);
+    }
+    c->checksum.fetch_add(checksum);
+}
+
+static void run_queries(void* context) {
+    ConcurrentCase* c = (ConcurrentCase*)context;
+    if (c->thread_count <= 1) {
+        answer_queries(c, 0, 1);
+        return;
+    }
+    
+    std::vector<std::thread> workers;
+    for (int32_t t = 0; t < c->thread_count; ++t) {
+        workers.emplace_back(answer_queries, c, t, c->thread_count);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config = default_bench_config();
+    if (!parse_bench_args(argc, argv, &config)) {
+        return 1;
+    }
+    
+    ConcurrentCase* c = new ConcurrentCase;
+    build_queries(c);
+    
+    BenchReport* report = new_bench_report();
+    if (report == NULL) {
+        delete c;
+        return 1;
+    }
+    
+    char params[BENCH_NAME_LENGTH];
+    const MemoBackend baselines[] = {MEMO_DENSE, MEMO_HASH};
+    const char* baseline_names[] = {"ackermann_queries_dense", "ackermann_queries_hash"};
+    double single_median = 0;
+    int64_t expected = 0;
+    bool consistent = true;
+    
+    c->thread_count = 1;
+    for (int32_t b = 0; b < 2; ++b) {
+        c->backend = baselines[b];
+        snprintf(params, sizeof(params), "queries=%d threads=1", QUERY_COUNT);
+        BenchResult result = run_benchmark(baseline_names[b], params, reset_memo, run_queries, NULL, c, config);
+        add_bench_result(report, result);
+        
+        if (b == 0) {
+            single_median = result.wall_median;
+            expected = c->checksum.load();
+        }
+    }
+    
+    int32_t hardware = (int32_t)std::thread::hardware_concurrency();
+    int32_t thread_counts[] = {1, 2, 4, 8, hardware};
+    const int32_t thread_options = sizeof(thread_counts) / sizeof(thread_counts[0]);
+    
+    c->backend = MEMO_CONCURRENT;
+    for (int32_t i = 0; i < thread_options; ++i) {
+        if (thread_counts[i] <= 0 || (i == thread_options - 1 && thread_counts[i] <= 8)) {
+            continue;
+        }
+        
+        c->thread_count = thread_counts[i];
+        snprintf(params, sizeof(params), "queries=%d threads=%d", QUERY_COUNT, c->thread_count);
+        BenchResult result = run_benchmark("ackermann_queries_concurrent", params, reset_memo, run_queries, NULL, c, config);
+        
+        if (c->checksum.load() != expected) {
+            fprintf(stderr, "checksum mismatch with %d threads\n", c->thread_count);
+            consistent = false;
+            continue;
+        }
+        
+        add_bench_result(report, result);
+        if (result.wall_median > 0) {
+            fprintf(stderr, "concurrent threads=%d: %.0f queries/sec, %.2fx vs single-threaded dense\n",
+                    c->thread_count, QUERY_COUNT / result.wall_median, single_median / result.wall_median);
+        }
+    }
+    
+    bool written = write_bench_report(report, config);
+    
+    cleanup_ackermann_table();
+    delete_bench_report(report);
+    delete c;
+    return (written && consistent) ? 0 : 1;
+}
@@ -0,0 +1,316 @@
+#include "./ackermann.h"
+
+static MemoBackend memo_backend = MEMO_HASH;
+static MatrixList* table = NULL;
+static HashTable* hash_memo = NULL;
+static ConcurrentMemo* concurrent_memo = NULL;
+static MemoStats memo_stats = { 0, 0, 0 };
+
+static uint64_t memo_key(int32_t m, int32_t n) {
+    return ((uint64_t)(uint32_t)m << 32) | (uint32_t)n;
+}
+
+void cleanup_ackermann_table() {
+    if (table != NULL) {
+        delete_matrix(table);
+        table = NULL;
+    }
+    
+    if (hash_memo != NULL) {
+        delete_hash_table(hash_memo);
+        hash_memo = NULL;
+    }
+    
+    if (concurrent_memo != NULL) {
+        delete_concurrent_memo(concurrent_memo);
+        concurrent_memo = NULL;
+    }
+}
+
+bool init_ackermann_table(int32_t max_m, int32_t max_n, MemoBackend backend) {
+    cleanup_ackermann_table();
+    memo_backend = backend;
+    
+    if (backend == MEMO_HASH) {
+        hash_memo = new_hash_table((int64_t)(max_m + 1) * (max_n + 1), MAX_MEMO_ENTRIES);
+        return hash_memo != NULL;
+    }
+    
+    if (backend == MEMO_CONCURRENT) {
+        concurrent_memo = new_concurrent_memo();
+        return concurrent_memo != NULL;
+    }
+    
+    table = new_matrix(max_m + 1, max_n + 1);
+    if (table == NULL) {
+        return false;
+    }
+    
+    fill_matrix(table, NOT_COMPUTED);
+    
+    return true;
+}
+
+bool save_ackermann_table(const char* path) {
+    if (memo_backend != MEMO_DENSE || table == NULL) {
+        return false;
+    }
+    
+    return save_matrix(table, path);
+}
+
+bool load_ackermann_table(const char* path) {
+    MatrixList* mapped = map_matrix(path, MATRIX_MAP_COPY_ON_WRITE);
+    if (mapped == NULL) {
+        return false;
+    }
+    
+    if (mapped->layout != MATRIX_ROW_MAJOR) {
+        delete_matrix(mapped);
+        return false;
+    }
+    
+    cleanup_ackermann_table();
+    memo_backend = MEMO_DENSE;
+    table = mapped;
+    return true;
+}
+
+void reset_memo_stats() {
+    memo_stats.hits = 0;
+    memo_stats.misses = 0;
+    memo_stats.stores = 0;
+    
+    if (hash_memo != NULL) {
+        hash_memo->evictions = 0;
+    }
+}
+
+MemoStats get_memo_stats() {
+    return memo_stats;
+}
+
+void print_memo_stats() {
+    if (concurrent_memo != NULL) {
+        printf("Memo backend: concurrent\n");
+        printf("Memo stores: %lld, chunks: %lld\n",
+               (long long)concurrent_memo->stores.load(),
+               (long long)concurrent_memo->chunk_count.load());
+        return;
+    }
+    
+    printf("Memo backend: %s\n", memo_backend == MEMO_HASH ? "hash" : "dense");
+    printf("Memo hits: %llu, misses: %llu, stores: %llu",
+           (unsigned long long)memo_stats.hits,
+           (unsigned long long)memo_stats.misses,
+           (unsigned long long)memo_stats.stores);
+    
+    if (hash_memo != NULL) {
+        printf(", entries: %lld, evictions: %lld", (long long)hash_memo->size, (long long)hash_memo->evictions);
+    } else if (table != NULL) {
+        printf(", table: %d x %d", table->rows, table->cols);
+    }
+    printf("\n");
+}
+
+bool is_in_table_range(int32_t m, int32_t n) {
+    if (table == NULL) {
+        return false;
+    }
+
+    return (m >= 0 && n >= 0 && m < table->rows && n < table->cols);
+}
+
+int32_t get_from_table(int32_t m, int32_t n) {
+    int32_t value = NOT_COMPUTED;
+    
+    if (memo_backend == MEMO_CONCURRENT) {
+        return concurrent_memo_get(concurrent_memo, m, n, &value) ? value : NOT_COMPUTED;
+    }
+    
+    if (memo_backend == MEMO_HASH) {
+        if (!hash_table_get(hash_memo, memo_key(m, n), &value)) {
+            value = NOT_COMPUTED;
+        }
+    } else if (is_in_table_range(m, n)) {
+        value = matrix_at(table, m, n);
+    }
+    
+    if (value == NOT_COMPUTED) {
+        ++memo_stats.misses;
+    } else {
+        ++memo_stats.hits;
+    }
+
+    return value;
+}
+
+void store_to_table(int32_t m, int32_t n, int32_t value) {
+    if (memo_backend == MEMO_CONCURRENT) {
+        concurrent_memo_put(concurrent_memo, m, n, value);
+        return;
+    }
+    
+    ++memo_stats.stores;
+    
+    if (memo_backend == MEMO_HASH) {
+        hash_table_put(hash_memo, memo_key(m, n), value);
+        return;
+    }
+    
+    if (table == NULL) {
+        return;
+    }
+    
+    if (m >= table->rows || n >= table->cols) {
+        int32_t old_rows = table->rows;
+        int32_t old_cols = table->cols;
+        int32_t new_rows = (m >= table->rows) ? (m < INT32_MAX - 10 ? m + 10 : INT32_MAX) : table->rows;
+        int32_t new_cols = (n >= table->cols) ? (n < INT32_MAX - 1000 ? n + 1000 : INT32_MAX) : table->cols;
+        
+        extend_matrix(table, new_rows, new_cols);
+        
+        if (table->rows == new_rows && table->cols == new_cols) {
+            fill_row_range(table, 0, old_rows, old_cols, new_cols, NOT_COMPUTED);
+            fill_row_range(table, old_rows, new_rows, 0, new_cols, NOT_COMPUTED);
+        }
+    }
+    
+    if (is_in_table_range(m, n) && is_matrix_writable(table)) {
+        matrix_set_at(table, m, n, value);
+    }
+}
+
+int32_t ackermann_function_memoization(int32_t m, int32_t n) {
+    if (m < 0 || n < 0) {
+        return INVALID_VALUE;
+    }
+
+    int32_t cached_value = get_from_table(m, n);
+    if (cached_value != NOT_COMPUTED) {
+
+        return cached_value;
+    }
+    
+    int32_t result;
+    
+    if (m == 0) {
+        result = n + 1;
+    } else if (m > 0 && n == 0) {
+        result = ackermann_function_memoization(m - 1, 1);
+    } else {
+        result = ackermann_function_memoization(m - 1, ackermann_function_memoization(m, n - 1));
+    }
+
+    store_to_table(m, n, result);
+    
+    return result;
+}
+
+int32_t ackermann_function_recursion(int32_t m, int32_t n) {
+    if (m == 0) {
+        return n + 1;
+    } else if (m > 0 && n == 0) {
+        return ackermann_function_recursion(m - 1, 1);
+    } else {
+        return ackermann_function_recursion(m - 1, ackermann_function_recursion(m, n - 1));
+    }
+}
+
+int32_t ackermann_function_iterative(int32_t m, int32_t n) {
+    if (m < 0 || n < 0) {
+        return INVALID_VALUE;
+    }
+    
+    FrameStack* stack = new_frame_stack();
+    if (stack == NULL || !push_frame(stack, m, n)) {
+        delete_frame_stack(stack);
+        return INVALID_VALUE;
+    }
+    
+    int32_t result = 0;
+    AckermannFrame frame;
+    
+    while (pop_frame(stack, &frame)) {
+        if (frame.m == 0) {
+            result = frame.n + 1;
+            
+            AckermannFrame* parent = top_frame(stack);
+            if (parent != NULL) {
+                parent->n = result;
+            }
+        } else if (frame.n == 0) {
+            if (!push_frame(stack, frame.m - 1, 1)) {
+                delete_frame_stack(stack);
+                return INVALID_VALUE;
+            }
+        } else {
+            if (!push_frame(stack, frame.m - 1, -1) ||
+                !push_frame(stack, frame.m, frame.n - 1)) {
+                delete_frame_stack(stack);
+                return INVALID_VALUE;
+            }
+        }
+    }
+    
+    delete_frame_stack(stack);
+    
+    return result;
+}
+
+bool ackermann_function_closed_form(int32_t m, int32_t n, BigInt* result) {
+    if (m < 0 || n < 0 || result == NULL) {
+        return false;
+    }
+    
+    if (m == 0) {
+        return set_bigint(result, (uint64_t)n + 1);
+    }
+    
+    if (m == 1) {
+        return set_bigint(result, (uint64_t)n + 2);
+    }
+    
+    if (m == 2) {
+        return set_bigint(result, 2 * (uint64_t)n + 3);
+    }
+    
+    if (m == 3) {
+        return set_bigint_power_of_two(result, (int64_t)n + 3) && sub_bigint_small(result, 3);
+    }
+    
+    if (m == 4) {
+        uint64_t exponent = 1;
+        for (int64_t height = 1; height < (int64_t)n + 3; ++height) {
+            if (exponent >= 63) {
+                return false;
+            }
+            exponent = (uint64_t)1 << exponent;
+        }
+        
+        return set_bigint_power_of_two(result, (int64_t)exponent) && sub_bigint_small(result, 3);
+    }
+    
+    if (n == 0) {
+        return ackermann_function_closed_form(m - 1, 1, result);
+    }
+    
+    return false;
+}
+
+void print_bigint_result(BigInt* num) {
+    char* text = bigint_to_string(num);
+    if (text == NULL) {
+        printf("Result: <out of memory>\n");
+        return;
+    }
+    
+    size_t digits = strlen(text);
+    if (digits <= 64) {
+        printf("Result: %s\n", text);
+    } else {
+        printf("Result: %.20s...%s (%zu digits)\n", text, text + digits - 20, digits);
+    }
+    
+    tracked_free(text);
+}
@@ -0,0 +1,62 @@
+#ifndef ACKERMANN_H
+#define ACKERMANN_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "./matrix.h"
+#include "./bigint.h"
+#include "./stack.h"
+#include "./hashtable.h"
+#include "./concurrent_memo.h"
+
+#define NOT_COMPUTED -1 
+#define INVALID_VALUE -2 
+
+#define MAX_MEMO_ENTRIES (1 << 20)
+
+typedef enum {
+    MEMO_DENSE,
+    MEMO_HASH,
+    MEMO_CONCURRENT
+} MemoBackend;
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t stores;
+} MemoStats;
+
+void cleanup_ackermann_table();
+
+bool init_ackermann_table(int32_t max_m, int32_t max_n, MemoBackend backend = MEMO_HASH);
+
+bool save_ackermann_table(const char* path);
+
+bool load_ackermann_table(const char* path);
+
+void reset_memo_stats();
+
+MemoStats get_memo_stats();
+
+void print_memo_stats();
+
+bool is_in_table_range(int32_t m, int32_t n);
+
+int32_t get_from_table(int32_t m, int32_t n);
+
+void store_to_table(int32_t m, int32_t n, int32_t value);
+
+int32_t ackermann_function_memoization(int32_t m, int32_t n);
+
+int32_t ackermann_function_recursion(int32_t m, int32_t n);
+
+int32_t ackermann_function_iterative(int32_t m, int32_t n);
+
+bool ackermann_function_closed_form(int32_t m, int32_t n, BigInt* result);
+
+void print_bigint_result(BigInt* num);
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef ALLOC_H
+#define ALLOC_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+typedef struct {
+    int64_t allocations;
+    int64_t frees;
+    int64_t reallocations;
+    int64_t bytes_allocated;
+    int64_t bytes_reallocated;
+    int64_t bytes_copied;
+    int64_t live_bytes;
+    int64_t peak_bytes;
+    int64_t baseline_bytes;
+} AllocStats;
+
+#ifdef DS_ALLOC_STATS
+
+void* tracked_malloc(size_t bytes);
+
+void* tracked_calloc(size_t count, size_t size);
+
+void* tracked_realloc(void* pointer, size_t bytes);
+
+void* tracked_aligned_alloc(size_t alignment, size_t bytes);
+
+void tracked_free(void* pointer);
+
+void record_copied_bytes(int64_t bytes);
+
+void reset_alloc_stats();
+
+AllocStats get_alloc_stats();
+
+void print_alloc_stats(const AllocStats* stats);
+
+#else
+
+static inline void* tracked_malloc(size_t bytes) { return malloc(bytes); }
+
+static inline void* tracked_calloc(size_t count, size_t size) { return calloc(count, size); }
+
+static inline void* tracked_realloc(void* pointer, size_t bytes) { return realloc(pointer, bytes); }
+
+static inline void* tracked_aligned_alloc(size_t alignment, size_t bytes) { return aligned_alloc(alignment, bytes); }
+
+static inline void tracked_free(void* pointer) { free(pointer); }
+
+static inline void record_copied_bytes(int64_t bytes) { (void)bytes; }
+
+static inline void reset_alloc_stats() {}
+
+static inline AllocStats get_alloc_stats() {
+    AllocStats stats;
+    memset(&stats, 0, sizeof(stats));
+    return stats;
+}
+
+static inline void print_alloc_stats(const AllocStats* stats) { (void)stats; }
+
+#endif
+
+bool checked_mul_i64(int64_t a, int64_t b, int64_t* result);
+
+bool checked_array_bytes(int64_t count, size_t element_size, size_t* bytes);
+
+void* malloc_array(int64_t count, size_t element_size);
+
+void* calloc_array(int64_t count, size_t element_size);
+
+void* realloc_array(void* pointer, int64_t count, size_t element_size);
+
+#endif
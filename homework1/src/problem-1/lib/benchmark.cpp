@@ -0,0 +1,295 @@
+#include "./benchmark.h"
+#include <time.h>
+#include <errno.h>
+#include <limits.h>
+
+static double timespec_seconds(clockid_t clock) {
+    struct timespec now;
+    clock_gettime(clock, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+void sort_samples(double* samples, int32_t count) {
+    qsort(samples, count, sizeof(double), compare_double);
+}
+
+double sample_percentile(double* sorted, int32_t count, double ratio) {
+    int32_t index = (int32_t)(ratio * (count - 1) + 0.5);
+    return sorted[index];
+}
+
+double wall_time_now() {
+    return timespec_seconds(CLOCK_MONOTONIC);
+}
+
+double cpu_time_now() {
+    return timespec_seconds(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+void start_timer(BenchTimer* timer) {
+    timer->wall = 0;
+    timer->cpu = 0;
+    timer->cpu_start = cpu_time_now();
+    timer->wall_start = wall_time_now();
+}
+
+void stop_timer(BenchTimer* timer) {
+    timer->wall = wall_time_now() - timer->wall_start;
+    timer->cpu = cpu_time_now() - timer->cpu_start;
+}
+
+BenchConfig default_bench_config() {
+    BenchConfig config;
+    config.warmup = 1;
+    config.repetitions = 5;
+    config.format = BENCH_TEXT;
+    config.output_path = NULL;
+    return config;
+}
+
+static bool parse_count(const char* arg, const char* value, int32_t min, int32_t* count) {
+    char* end = NULL;
+    errno = 0;
+    long parsed = strtol(value, &end, 10);
+    
+    if (end == value || *end != '\0' || errno == ERANGE || parsed > INT32_MAX) {
+        fprintf(stderr, "Invalid value for %s: %s\n", arg, value);
+        return false;
+    }
+    
+    if (parsed < min) {
+        fprintf(stderr, "Value for %s must be at least %d: %s\n", arg, min, value);
+        return false;
+    }
+    
+    *count = (int32_t)parsed;
+    return true;
+}
+
+static bool is_bench_option(const char* arg) {
+    return strcmp(arg, "--warmup") == 0 || strcmp(arg, "--repetitions") == 0
+        || strcmp(arg, "--output") == 0 || strcmp(arg, "--format") == 0;
+}
+
+bool parse_bench_args(int argc, char** argv, BenchConfig* config) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        
+        if (!is_bench_option(arg)) {
+            fprintf(stderr, "Unknown option: %s\n", arg);
+            return false;
+        }
+        
+        if (value == NULL) {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+        
+        if (strcmp(arg, "--warmup") == 0) {
+            if (!parse_count(arg, value, 0, &config->warmup)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--repetitions") == 0) {
+            if (!parse_count(arg, value, 1, &config->repetitions)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--output") == 0) {
+            config->output_path = value;
+        } else {
+            if (strcmp(value, "json") == 0) {
+                config->format = BENCH_JSON;
+            } else if (strcmp(value, "csv") == 0) {
+                config->format = BENCH_CSV;
+            } else if (strcmp(value, "text") == 0) {
+                config->format = BENCH_TEXT;
+            } else {
+                fprintf(stderr, "Unknown format: %s\n", value);
+                return false;
+            }
+        }
+        
+        ++i;
+    }
+    
+    return true;
+}
+
+BenchResult run_benchmark(const char* name, const char* params, BenchFunction setup,
+                          BenchFunction function, BenchFunction teardown,
+                          void* context, BenchConfig config) {
+    BenchResult result;
+    memset(&result, 0, sizeof(BenchResult));
+    snprintf(result.name, BENCH_NAME_LENGTH, "%s", name);
+    snprintf(result.params, BENCH_NAME_LENGTH, "%s", params);
+    
+    double* wall = (double*)malloc(sizeof(double) * config.repetitions);
+    double* cpu = (double*)malloc(sizeof(double) * config.repetitions);
+    if (wall == NULL || cpu == NULL) {
+        free(wall);
+        free(cpu);
+        return result;
+    }
+    
+    for (int32_t i = 0; i < config.warmup + config.repetitions; ++i) {
+        if (setup != NULL) setup(context);
+        
+        BenchTimer timer;
+        start_timer(&timer);
+        function(context);
+        stop_timer(&timer);
+        
+        if (teardown != NULL) teardown(context);
+        
+        if (i >= config.warmup) {
+            wall[i - config.warmup] = timer.wall;
+            cpu[i - config.warmup] = timer.cpu;
+        }
+    }
+    
+    sort_samples(wall, config.repetitions);
+    sort_samples(cpu, config.repetitions);
+    
+    result.repetitions = config.repetitions;
+    result.wall_median = sample_percentile(wall, config.repetitions, 0.5);
+    result.wall_p95 = sample_percentile(wall, config.repetitions, 0.95);
+    result.wall_min = wall[0];
+    result.cpu_median = sample_percentile(cpu, config.repetitions, 0.5);
+    result.cpu_p95 = sample_percentile(cpu, config.repetitions, 0.95);
+    result.cpu_min = cpu[0];
+    
+    free(wall);
+    free(cpu);
+    return result;
+}
+
+BenchReport* new_bench_report() {
+    BenchReport* report = (BenchReport*)malloc(sizeof(BenchReport));
+    if (report == NULL) {
+        return NULL;
+    }
+    
+    report->capacity = 16;
+    report->count = 0;
+    report->results = (BenchResult*)malloc(sizeof(BenchResult) * report->capacity);
+    if (report->results == NULL) {
+        free(report);
+        return NULL;
+    }
+    
+    return report;
+}
+
+void delete_bench_report(BenchReport* report) {
+    if (report != NULL) {
+        free(report->results);
+        free(report);
+    }
+}
+
+void add_bench_result(BenchReport* report, BenchResult result) {
+    if (report == NULL) {
+        return;
+    }
+    
+    if (report->count == report->capacity) {
+        int32_t new_capacity = report->capacity * 2;
+        BenchResult* extend = (BenchResult*)realloc(report->results, sizeof(BenchResult) * new_capacity);
+        if (extend == NULL) {
+            return;
+        }
+        report->results = extend;
+        report->capacity = new_capacity;
+    }
+    
+    report->results[report->count] = result;
+    ++report->count;
+}
+
+static void write_text(BenchReport* report, FILE* out) {
+    int name_width = 28;
+    int params_width = 16;
+    for (int32_t i = 0; i < report->count; ++i) {
+        int name_length = (int)strlen(report->results[i].name);
+        int params_length = (int)strlen(report->results[i].params);
+        if (name_length > name_width) name_width = name_length;
+        if (params_length > params_width) params_width = params_length;
+    }
+    
+    fprintf(out, "%-*s %-*s %5s %12s %12s %12s %12s %12s %12s\n",
+            name_width, "name", params_width, "params", "reps", "wall_median", "wall_p95", "wall_min",
+            "cpu_median", "cpu_p95", "cpu_min");
+    
+    for (int32_t i = 0; i < report->count; ++i) {
+        BenchResult* r = &report->results[i];
+        fprintf(out, "%-*s %-*s %5d %12.6f %12.6f %12.6f %12.6f %12.6f %12.6f\n",
+                name_width, r->name, params_width, r->params, r->repetitions, r->wall_median, r->wall_p95, r->wall_min,
+                r->cpu_median, r->cpu_p95, r->cpu_min);
+    }
+}
+
+static void write_csv(BenchReport* report, FILE* out) {
+    fprintf(out, "name,params,repetitions,wall_median,wall_p95,wall_min,cpu_median,cpu_p95,cpu_min\n");
+    
+    for (int32_t i = 0; i < report->count; ++i) {
+        BenchResult* r = &report->results[i];
+        fprintf(out, "%s,\"%s\",%d,%.9f,%.9f,%.9f,%.9f,%.9f,%.9f\n",
+                r->name, r->params, r->repetitions, r->wall_median, r->wall_p95, r->wall_min,
+                r->cpu_median, r->cpu_p95, r->cpu_min);
+    }
+}
+
+static void write_json(BenchReport* report, FILE* out) {
+    fprintf(out, "[\n");
+    
+    for (int32_t i = 0; i < report->count; ++i) {
+        BenchResult* r = &report->results[i];
+        fprintf(out, "  {\"name\": \"%s\", \"params\": \"%s\", \"repetitions\": %d, "
+                "\"wall\": {\"median\": %.9f, \"p95\": %.9f, \"min\": %.9f}, "
+                "\"cpu\": {\"median\": %.9f, \"p95\": %.9f, \"min\": %.9f}}%s\n",
+                r->name, r->params, r->repetitions, r->wall_median, r->wall_p95, r->wall_min,
+                r->cpu_median, r->cpu_p95, r->cpu_min, (i < report->count - 1) ? "," : "");
+    }
+    
+    fprintf(out, "]\n");
+}
+
+bool write_bench_report(BenchReport* report, BenchConfig config) {
+    if (report == NULL) {
+        return false;
+    }
+    
+    FILE* out = stdout;
+    if (config.output_path != NULL) {
+        out = fopen(config.output_path, "w");
+        if (out == NULL) {
+            fprintf(stderr, "Cannot open %s\n", config.output_path);
+            return false;
+        }
+    }
+    
+    switch (config.format) {
+        case BENCH_JSON:
+            write_json(report, out);
+            break;
+        case BENCH_CSV:
+            write_csv(report, out);
+            break;
+        default:
+            write_text(report, out);
+            break;
+    }
+    
+    if (out != stdout && fclose(out) != 0) {
+        fprintf(stderr, "Cannot write %s\n", config.output_path);
+        return false;
+    }
+    
+    return true;
+}
@@ -0,0 +1,193 @@
+#include "./bigint.h"
+
+static bool reserve_bigint(BigInt* num, int64_t limbs) {
+    if (limbs <= num->capacity) {
+        return true;
+    }
+    
+    uint32_t* extend = (uint32_t*)tracked_realloc(num->limbs, sizeof(uint32_t) * limbs);
+    if (extend == NULL) {
+        return false;
+    }
+    
+    num->limbs = extend;
+    num->capacity = limbs;
+    return true;
+}
+
+static void trim_bigint(BigInt* num) {
+    while (num->size > 0 && num->limbs[num->size - 1] == 0) {
+        --num->size;
+    }
+}
+
+BigInt* new_bigint(uint64_t value) {
+    BigInt* num = (BigInt*)tracked_malloc(sizeof(BigInt));
+    if (num == NULL) {
+        return NULL;
+    }
+    
+    num->limbs = NULL;
+    num->size = 0;
+    num->capacity = 0;
+    
+    if (!set_bigint(num, value)) {
+        tracked_free(num);
+        return NULL;
+    }
+    
+    return num;
+}
+
+void delete_bigint(BigInt* num) {
+    if (num != NULL) {
+        tracked_free(num->limbs);
+        tracked_free(num);
+    }
+}
+
+bool set_bigint(BigInt* num, uint64_t value) {
+    if (num == NULL || !reserve_bigint(num, 2)) {
+        return false;
+    }
+    
+    num->limbs[0] = (uint32_t)value;
+    num->limbs[1] = (uint32_t)(value >> 32);
+    num->size = 2;
+    trim_bigint(num);
+    return true;
+}
+
+bool set_bigint_power_of_two(BigInt* num, int64_t exponent) {
+    if (num == NULL || exponent < 0 || exponent >= MAX_BIGINT_BITS) {
+        return false;
+    }
+    
+    int64_t limbs = exponent / 32 + 1;
+    if (!reserve_bigint(num, limbs)) {
+        return false;
+    }
+    
+    memset(num->limbs, 0, sizeof(uint32_t) * limbs);
+    num->limbs[limbs - 1] = (uint32_t)1 << (exponent % 32);
+    num->size = limbs;
+    return true;
+}
+
+bool add_bigint_small(BigInt* num, uint32_t value) {
+    if (num == NULL || !reserve_bigint(num, num->size + 1)) {
+        return false;
+    }
+    
+    uint64_t carry = value;
+    for (int64_t i = 0; i < num->size && carry != 0; ++i) {
+        uint64_t sum = (uint64_t)num->limbs[i] + carry;
+        num->limbs[i] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+    
+    if (carry != 0) {
+        num->limbs[num->size] = (uint32_t)carry;
+        ++num->size;
+    }
+    
+    return true;
+}
+
+bool sub_bigint_small(BigInt* num, uint32_t value) {
+    if (num == NULL) {
+        return false;
+    }
+    
+    uint32_t low = (num->size == 0) ? 0 : num->limbs[0];
+    if (num->size <= 1 && low < value) {
+        return false;
+    }
+    
+    uint64_t borrow = value;
+    for (int64_t i = 0; i < num->size && borrow != 0; ++i) {
+        uint64_t limb = num->limbs[i];
+        num->limbs[i] = (uint32_t)(limb - borrow);
+        borrow = (limb < borrow) ? 1 : 0;
+    }
+    
+    trim_bigint(num);
+    return true;
+}
+
+int64_t bigint_bit_length(BigInt* num) {
+    if (num == NULL || num->size == 0) {
+        return 0;
+    }
+    
+    return (num->size - 1) * 32 + (32 - __builtin_clz(num->limbs[num->size - 1]));
+}
+
+bool bigint_to_int64(BigInt* num, int64_t* value) {
+    if (num == NULL || bigint_bit_length(num) > 63) {
+        return false;
+    }
+    
+    uint64_t result = 0;
+    for (int64_t i = num->size - 1; i >= 0; --i) {
+        result = (result << 32) | num->limbs[i];
+    }
+    
+    *value = (int64_t)result;
+    return true;
+}
+
+char* bigint_to_string(BigInt* num) {
+    if (num == NULL) {
+        return NULL;
+    }
+    
+    const uint32_t chunk_base = 1000000000;
+    int64_t max_chunks = num->size * 10 / 9 + 2;
+    
+    uint32_t* work = (uint32_t*)tracked_malloc(sizeof(uint32_t) * (num->size > 0 ? num->size : 1));
+    uint32_t* chunks = (uint32_t*)tracked_malloc(sizeof(uint32_t) * max_chunks);
+    if (work == NULL || chunks == NULL) {
+        tracked_free(work);
+        tracked_free(chunks);
+        return NULL;
+    }
+    
+    memcpy(work, num->limbs, sizeof(uint32_t) * num->size);
+    int64_t work_size = num->size;
+    int64_t chunk_count = 0;
+    
+    while (work_size > 0) {
+        uint64_t remainder = 0;
+        for (int64_t i = work_size - 1; i >= 0; --i) {
+            uint64_t current = (remainder << 32) | work[i];
+            work[i] = (uint32_t)(current / chunk_base);
+            remainder = current % chunk_base;
+        }
+        chunks[chunk_count++] = (uint32_t)remainder;
+        
+        while (work_size > 0 && work[work_size - 1] == 0) {
+            --work_size;
+        }
+    }
+    
+    char* text = (char*)tracked_malloc(chunk_count * 9 + 2);
+    if (text == NULL) {
+        tracked_free(work);
+        tracked_free(chunks);
+        return NULL;
+    }
+    
+    if (chunk_count == 0) {
+        strcpy(text, "0");
+    } else {
+        char* cursor = text + sprintf(text, "%u", chunks[chunk_count - 1]);
+        for (int64_t i = chunk_count - 2; i >= 0; --i) {
+            cursor += sprintf(cursor, "%09u", chunks[i]);
+        }
+    }
+    
+    tracked_free(work);
+    tracked_free(chunks);
+    return text;
+}
@@ -0,0 +1,37 @@
+#ifndef BIGINT_H
+#define BIGINT_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "./alloc.h"
+
+#define MAX_BIGINT_BITS ((int64_t)1 << 28)
+
+typedef struct {
+    uint32_t *limbs;
+    int64_t size;
+    int64_t capacity;
+} BigInt;
+
+BigInt* new_bigint(uint64_t value);
+
+void delete_bigint(BigInt* num);
+
+bool set_bigint(BigInt* num, uint64_t value);
+
+bool set_bigint_power_of_two(BigInt* num, int64_t exponent);
+
+bool add_bigint_small(BigInt* num, uint32_t value);
+
+bool sub_bigint_small(BigInt* num, uint32_t value);
+
+int64_t bigint_bit_length(BigInt* num);
+
+bool bigint_to_int64(BigInt* num, int64_t* value);
+
+char* bigint_to_string(BigInt* num);
+
+#endif
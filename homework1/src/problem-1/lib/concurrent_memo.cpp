@@ -0,0 +1,125 @@
+#include "./concurrent_memo.h"
+#include <new>
+
+static bool locate_slot(int32_t m, int32_t n, int32_t* chunk, int64_t* offset) {
+    if (m < 0 || n < 0 || m >= CONCURRENT_MEMO_ROWS) {
+        return false;
+    }
+    
+    int64_t blocks = (int64_t)n / CONCURRENT_MEMO_BASE + 1;
+    int32_t k = 63 - __builtin_clzll((unsigned long long)blocks);
+    if (k >= CONCURRENT_MEMO_CHUNKS) {
+        return false;
+    }
+    
+    *chunk = k;
+    *offset = (int64_t)n - (int64_t)CONCURRENT_MEMO_BASE * (((int64_t)1 << k) - 1);
+    return true;
+}
+
+static int64_t chunk_length(int32_t chunk) {
+    return (int64_t)CONCURRENT_MEMO_BASE << chunk;
+}
+
+static MemoSlot* new_chunk(int32_t chunk) {
+    int64_t length = chunk_length(chunk);
+    MemoSlot* slots = (MemoSlot*)malloc_array(length, sizeof(MemoSlot));
+    if (slots == NULL) {
+        return NULL;
+    }
+    
+    for (int64_t i = 0; i < length; ++i) {
+        new (&slots[i]) MemoSlot(CONCURRENT_MEMO_EMPTY);
+    }
+    return slots;
+}
+
+ConcurrentMemo* new_concurrent_memo() {
+    void* memory = tracked_malloc(sizeof(ConcurrentMemo));
+    if (memory == NULL) {
+        return NULL;
+    }
+    
+    ConcurrentMemo* memo = new (memory) ConcurrentMemo;
+    for (int32_t i = 0; i < CONCURRENT_MEMO_ROWS; ++i) {
+        for (int32_t k = 0; k < CONCURRENT_MEMO_CHUNKS; ++k) {
+            memo->chunks[i][k].store(NULL, std::memory_order_relaxed);
+        }
+    }
+    memo->chunk_count.store(0, std::memory_order_relaxed);
+    memo->stores.store(0, std::memory_order_relaxed);
+    return memo;
+}
+
+void clear_concurrent_memo(ConcurrentMemo* memo) {
+    if (memo == NULL) {
+        return;
+    }
+    
+    for (int32_t i = 0; i < CONCURRENT_MEMO_ROWS; ++i) {
+        for (int32_t k = 0; k < CONCURRENT_MEMO_CHUNKS; ++k) {
+            tracked_free(memo->chunks[i][k].exchange(NULL, std::memory_order_acq_rel));
+        }
+    }
+    memo->chunk_count.store(0, std::memory_order_relaxed);
+    memo->stores.store(0, std::memory_order_relaxed);
+}
+
+void delete_concurrent_memo(ConcurrentMemo* memo) {
+    if (memo != NULL) {
+        clear_concurrent_memo(memo);
+        memo->~ConcurrentMemo();
+        tracked_free(memo);
+    }
+}
+
+bool concurrent_memo_get(ConcurrentMemo* memo, int32_t m, int32_t n, int32_t* value) {
+    int32_t chunk = 0;
+    int64_t offset = 0;
+    if (memo == NULL || !locate_slot(m, n, &chunk, &offset)) {
+        return false;
+    }
+    
+    MemoSlot* slots = memo->chunks[m][chunk].load(std::memory_order_acquire);
+    if (slots == NULL) {
+        return false;
+    }
+    
+    int32_t stored = slots[offset].load(std::memory_order_acquire);
+    if (stored == CONCURRENT_MEMO_EMPTY) {
+        return false;
+    }
+    
+    *value = stored;
+    return true;
+}
+
+bool concurrent_memo_put(ConcurrentMemo* memo, int32_t m, int32_t n, int32_t value) {
+    int32_t chunk = 0;
+    int64_t offset = 0;
+    if (memo == NULL || value == CONCURRENT_MEMO_EMPTY || !locate_slot(m, n, &chunk, &offset)) {
+        return false;
+    }
+    
+    MemoSlot* slots = memo->chunks[m][chunk].load(std::memory_order_acquire);
+    if (slots == NULL) {
+        MemoSlot* fresh = new_chunk(chunk);
+        if (fresh == NULL) {
+            return false;
+        }
+        
+        if (memo->chunks[m][chunk].compare_exchange_strong(slots, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            slots = fresh;
+            memo->chunk_count.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            tracked_free(fresh);
+        }
+    }
+    
+    int32_t expected = CONCURRENT_MEMO_EMPTY;
+    if (slots[offset].compare_exchange_strong(expected, value, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        memo->stores.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return expected == value;
+}
@@ -0,0 +1,35 @@
+#ifndef CONCURRENT_MEMO_H
+#define CONCURRENT_MEMO_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <atomic>
+#include "./alloc.h"
+
+#define CONCURRENT_MEMO_EMPTY -1
+#define CONCURRENT_MEMO_ROWS 8
+#define CONCURRENT_MEMO_BASE 1024
+#define CONCURRENT_MEMO_CHUNKS 15
+
+typedef std::atomic<int32_t> MemoSlot;
+
+typedef struct {
+    std::atomic<MemoSlot*> chunks[CONCURRENT_MEMO_ROWS][CONCURRENT_MEMO_CHUNKS];
+    std::atomic<int64_t> chunk_count;
+    std::atomic<int64_t> stores;
+} ConcurrentMemo;
+
+ConcurrentMemo* new_concurrent_memo();
+
+void delete_concurrent_memo(ConcurrentMemo* memo);
+
+bool concurrent_memo_get(ConcurrentMemo* memo, int32_t m, int32_t n, int32_t* value);
+
+bool concurrent_memo_put(ConcurrentMemo* memo, int32_t m, int32_t n, int32_t value);
+
+void clear_concurrent_memo(ConcurrentMemo* memo);
+
+#endif
@@ -0,0 +1,200 @@
+#include "./hashtable.h"
+
+static uint64_t hash_key(uint64_t key) {
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+static int64_t next_power_of_two(int64_t value) {
+    int64_t power = MIN_HASH_CAPACITY;
+    while (power < value) {
+        power <<= 1;
+    }
+    return power;
+}
+
+static HashEntry* new_entries(int64_t capacity) {
+    HashEntry* entries = (HashEntry*)tracked_malloc(sizeof(HashEntry) * capacity);
+    if (entries == NULL) {
+        return NULL;
+    }
+    
+    for (int64_t i = 0; i < capacity; ++i) {
+        entries[i].key = EMPTY_HASH_KEY;
+        entries[i].referenced = false;
+    }
+    
+    return entries;
+}
+
+static int64_t find_slot(HashEntry* entries, int64_t capacity, uint64_t key) {
+    int64_t mask = capacity - 1;
+    int64_t slot = (int64_t)(hash_key(key) & (uint64_t)mask);
+    
+    while (entries[slot].key != EMPTY_HASH_KEY && entries[slot].key != key) {
+        slot = (slot + 1) & mask;
+    }
+    
+    return slot;
+}
+
+static bool rehash(HashTable* table, int64_t new_capacity) {
+    HashEntry* entries = new_entries(new_capacity);
+    if (entries == NULL) {
+        return false;
+    }
+    
+    for (int64_t i = 0; i < table->capacity; ++i) {
+        if (table->entries[i].key != EMPTY_HASH_KEY) {
+            entries[find_slot(entries, new_capacity, table->entries[i].key)] = table->entries[i];
+        }
+    }
+    record_copied_bytes((int64_t)sizeof(HashEntry) * table->size);
+    
+    tracked_free(table->entries);
+    table->entries = entries;
+    table->capacity = new_capacity;
+    table->hand = 0;
+    return true;
+}
+
+static void remove_slot(HashTable* table, int64_t slot) {
+    int64_t mask = table->capacity - 1;
+    int64_t next = slot;
+    
+    while (true) {
+        next = (next + 1) & mask;
+        if (table->entries[next].key == EMPTY_HASH_KEY) {
+            break;
+        }
+        
+        int64_t home = (int64_t)(hash_key(table->entries[next].key) & (uint64_t)mask);
+        bool stays = (slot <= next) ? (slot < home && home <= next) : (slot < home || home <= next);
+        if (!stays) {
+            table->entries[slot] = table->entries[next];
+            slot = next;
+        }
+    }
+    
+    table->entries[slot].key = EMPTY_HASH_KEY;
+    table->entries[slot].referenced = false;
+    --table->size;
+}
+
+static void evict_one(HashTable* table) {
+    int64_t mask = table->capacity - 1;
+    
+    while (true) {
+        HashEntry* entry = &table->entries[table->hand];
+        
+        if (entry->key != EMPTY_HASH_KEY) {
+            if (!entry->referenced) {
+                remove_slot(table, table->hand);
+                ++table->evictions;
+                return;
+            }
+            entry->referenced = false;
+        }
+        
+        table->hand = (table->hand + 1) & mask;
+    }
+}
+
+HashTable* new_hash_table(int64_t initial_entries, int64_t max_entries) {
+    if (max_entries <= 0) {
+        return NULL;
+    }
+    
+    HashTable* table = (HashTable*)tracked_malloc(sizeof(HashTable));
+    if (table == NULL) {
+        return NULL;
+    }
+    
+    table->max_size = max_entries;
+    table->max_capacity = next_power_of_two(table->max_size + table->max_size / 3);
+    table->capacity = next_power_of_two(initial_entries + initial_entries / 3);
+    if (table->capacity > table->max_capacity) {
+        table->capacity = table->max_capacity;
+    }
+    
+    table->entries = new_entries(table->capacity);
+    if (table->entries == NULL) {
+        tracked_free(table);
+        return NULL;
+    }
+    
+    table->size = 0;
+    table->hand = 0;
+    table->evictions = 0;
+    return table;
+}
+
+void delete_hash_table(HashTable* table) {
+    if (table != NULL) {
+        tracked_free(table->entries);
+        tracked_free(table);
+    }
+}
+
+bool hash_table_get(HashTable* table, uint64_t key, int32_t* value) {
+    if (table == NULL || key == EMPTY_HASH_KEY) {
+        return false;
+    }
+    
+    HashEntry* entry = &table->entries[find_slot(table->entries, table->capacity, key)];
+    if (entry->key == EMPTY_HASH_KEY) {
+        return false;
+    }
+    
+    entry->referenced = true;
+    *value = entry->value;
+    return true;
+}
+
+void hash_table_put(HashTable* table, uint64_t key, int32_t value) {
+    if (table == NULL || key == EMPTY_HASH_KEY) {
+        return;
+    }
+    
+    int64_t slot = find_slot(table->entries, table->capacity, key);
+    if (table->entries[slot].key == key) {
+        table->entries[slot].value = value;
+        table->entries[slot].referenced = true;
+        return;
+    }
+    
+    if (table->size >= table->max_size) {
+        evict_one(table);
+        slot = find_slot(table->entries, table->capacity, key);
+    } else if (table->size + 1 > table->capacity / 4 * 3) {
+        if (table->capacity < table->max_capacity && rehash(table, table->capacity * 2)) {
+            slot = find_slot(table->entries, table->capacity, key);
+        } else {
+            evict_one(table);
+            slot = find_slot(table->entries, table->capacity, key);
+        }
+    }
+    
+    table->entries[slot].key = key;
+    table->entries[slot].value = value;
+    table->entries[slot].referenced = true;
+    ++table->size;
+}
+
+void clear_hash_table(HashTable* table) {
+    if (table == NULL) {
+        return;
+    }
+    
+    for (int64_t i = 0; i < table->capacity; ++i) {
+        table->entries[i].key = EMPTY_HASH_KEY;
+        table->entries[i].referenced = false;
+    }
+    
+    table->size = 0;
+    table->hand = 0;
+}
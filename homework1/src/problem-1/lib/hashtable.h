@@ -0,0 +1,40 @@
+#ifndef HASHTABLE_H
+#define HASHTABLE_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "./alloc.h"
+
+#define EMPTY_HASH_KEY UINT64_MAX
+#define MIN_HASH_CAPACITY 64
+
+typedef struct {
+    uint64_t key;
+    int32_t value;
+    bool referenced;
+} HashEntry;
+
+typedef struct {
+    HashEntry* entries;
+    int64_t capacity;
+    int64_t size;
+    int64_t max_capacity;
+    int64_t max_size;
+    int64_t hand;
+    int64_t evictions;
+} HashTable;
+
+HashTable* new_hash_table(int64_t initial_entries, int64_t max_entries);
+
+void delete_hash_table(HashTable* table);
+
+bool hash_table_get(HashTable* table, uint64_t key, int32_t* value);
+
+void hash_table_put(HashTable* table, uint64_t key, int32_t value);
+
+void clear_hash_table(HashTable* table);
+
+#endif
@@ -1,115 +1,303 @@
 #include "./matrix.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-static int32_t get_index(MatrixList* matrix, int32_t row, int32_t col) {
-    return row * matrix->cols + col;
+#define COPY_BLOCK 32
+
+static int32_t round_capacity(MatrixLayout layout, int32_t capacity) {
+    if (layout != MATRIX_TILED) {
+        return capacity;
+    }
+    
+    return (int32_t)(((int64_t)capacity + MATRIX_TILE_SIZE - 1) / MATRIX_TILE_SIZE * MATRIX_TILE_SIZE);
+}
+
+template <typename Visitor>
+static bool visit_runs(MatrixList* matrix, int32_t row_begin, int32_t row_end,
+                       int32_t col_begin, int32_t col_end, Visitor visit) {
+    if (matrix->layout == MATRIX_COL_MAJOR) {
+        if (row_begin == 0 && row_end == matrix->row_capacity && col_begin < col_end) {
+            return visit(&matrix->data[matrix_cell_index(matrix, 0, col_begin)], (int64_t)(col_end - col_begin) * row_end);
+        }
+        
+        for (int32_t j = col_begin; j < col_end; j++) {
+            if (!visit(&matrix->data[matrix_cell_index(matrix, row_begin, j)], (int64_t)(row_end - row_begin))) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    if (matrix->layout == MATRIX_ROW_MAJOR && col_begin == 0 && col_end == matrix->col_capacity && row_begin < row_end) {
+        return visit(&matrix->data[matrix_cell_index(matrix, row_begin, 0)], (int64_t)(row_end - row_begin) * col_end);
+    }
+    
+    for (int32_t i = row_begin; i < row_end; i++) {
+        int32_t j = col_begin;
+        while (j < col_end) {
+            int32_t run = col_end - j;
+            if (matrix->layout == MATRIX_TILED && run > MATRIX_TILE_SIZE - j % MATRIX_TILE_SIZE) {
+                run = MATRIX_TILE_SIZE - j % MATRIX_TILE_SIZE;
+            }
+            
+            if (!visit(&matrix->data[matrix_cell_index(matrix, i, j)], (int64_t)run)) {
+                return false;
+            }
+            j += run;
+        }
+    }
+    return true;
+}
+
+static void fill_region(MatrixList* matrix, int32_t row_begin, int32_t row_end,
+                        int32_t col_begin, int32_t col_end, int32_t value) {
+    visit_runs(matrix, row_begin, row_end, col_begin, col_end, [value](int32_t* cells, int64_t count) {
+        simd_fill_i32(cells, count, value);
+        return true;
+    });
 }
 
-MatrixList* new_matrix(int32_t rows, int32_t cols) {
+static void copy_region(MatrixList* matrix, int32_t* new_data, MatrixLayout layout,
+                        int32_t row_capacity, int32_t col_capacity, int32_t rows, int32_t cols) {
+    if (layout == matrix->layout && layout == MATRIX_ROW_MAJOR) {
+        for (int32_t i = 0; i < rows; i++) {
+            memcpy(&new_data[(int64_t)i * col_capacity], &matrix->data[matrix_cell_index(matrix, i, 0)], sizeof(int32_t) * cols);
+        }
+        return;
+    }
+    
+    if (layout == matrix->layout && layout == MATRIX_COL_MAJOR) {
+        for (int32_t j = 0; j < cols; j++) {
+            memcpy(&new_data[(int64_t)j * row_capacity], &matrix->data[matrix_cell_index(matrix, 0, j)], sizeof(int32_t) * rows);
+        }
+        return;
+    }
+    
+    for (int32_t bi = 0; bi < rows; bi += COPY_BLOCK) {
+        for (int32_t bj = 0; bj < cols; bj += COPY_BLOCK) {
+            int32_t i_end = bi + COPY_BLOCK < rows ? bi + COPY_BLOCK : rows;
+            int32_t j_end = bj + COPY_BLOCK < cols ? bj + COPY_BLOCK : cols;
+            
+            for (int32_t i = bi; i < i_end; i++) {
+                for (int32_t j = bj; j < j_end; j++) {
+                    new_data[matrix_index_for(layout, row_capacity, col_capacity, i, j)] = matrix->data[matrix_cell_index(matrix, i, j)];
+                }
+            }
+        }
+    }
+}
+
+MatrixList* new_matrix(int32_t rows, int32_t cols, MatrixLayout layout) {
     if (rows <= 0 || cols <= 0) {
         return NULL;
     }
     
-    MatrixList* matrix = (MatrixList*)malloc(sizeof(MatrixList));
+    MatrixList* matrix = (MatrixList*)tracked_malloc(sizeof(MatrixList));
     if (matrix == NULL) {
         return NULL;
     }
     
+    matrix->storage = MATRIX_HEAP;
+    matrix->mapping = NULL;
+    matrix->mapping_size = 0;
+    matrix->layout = layout;
     matrix->rows = rows;
     matrix->cols = cols;
-    matrix->capacity = rows * cols;
+    matrix->row_capacity = round_capacity(layout, rows);
+    matrix->col_capacity = round_capacity(layout, cols);
+    matrix->capacity = (int64_t)matrix->row_capacity * matrix->col_capacity;
     matrix->extend_ratio = 2;
     
-    matrix->data = (int32_t*)malloc(sizeof(int32_t) * matrix->capacity);
+    matrix->data = (int32_t*)malloc_array(matrix->capacity, sizeof(int32_t));
     if (matrix->data == NULL) {
-        free(matrix);
+        tracked_free(matrix);
         return NULL;
     }
     
-    memset(matrix->data, 0, sizeof(int32_t) * matrix->capacity);
+    memset(matrix->data, 0, sizeof(int32_t) * (size_t)matrix->capacity);
     
     return matrix;
 }
 
+static void release_matrix_data(MatrixList* matrix) {
+    if (matrix->storage == MATRIX_HEAP) {
+        tracked_free(matrix->data);
+    } else {
+        munmap(matrix->mapping, matrix->mapping_size);
+        matrix->mapping = NULL;
+        matrix->mapping_size = 0;
+        matrix->storage = MATRIX_HEAP;
+    }
+}
+
 void delete_matrix(MatrixList* matrix) {
     if (matrix != NULL) {
-        free(matrix->data);
-        free(matrix);
+        release_matrix_data(matrix);
+        tracked_free(matrix);
     }
 }
 
-void extend_matrix(MatrixList* matrix, int32_t new_rows, int32_t new_cols) {
-    if (matrix == NULL || new_rows <= 0 || new_cols <= 0) { 
-        return;
+static bool relocate_matrix(MatrixList* matrix, MatrixLayout layout, int32_t row_capacity, int32_t col_capacity) {
+    row_capacity = round_capacity(layout, row_capacity);
+    col_capacity = round_capacity(layout, col_capacity);
+    
+    int64_t new_capacity = (int64_t)row_capacity * col_capacity;
+    int32_t* new_data = (int32_t*)malloc_array(new_capacity, sizeof(int32_t));
+    
+    if (new_data == NULL) {
+        return false;
     }
     
-    int32_t new_capacity = new_rows * new_cols;
-    int32_t* new_data = (int32_t*)malloc(sizeof(int32_t) * new_capacity);
+    int32_t copy_rows = matrix->rows < row_capacity ? matrix->rows : row_capacity;
+    int32_t copy_cols = matrix->cols < col_capacity ? matrix->cols : col_capacity;
+    
+    copy_region(matrix, new_data, layout, row_capacity, col_capacity, copy_rows, copy_cols);
+    record_copied_bytes((int64_t)sizeof(int32_t) * copy_rows * copy_cols);
+    
+    release_matrix_data(matrix);
+    matrix->data = new_data;
+    matrix->layout = layout;
+    matrix->row_capacity = row_capacity;
+    matrix->col_capacity = col_capacity;
+    matrix->capacity = new_capacity;
+    return true;
+}
 
-    if (new_data == NULL) { 
-        return;
+static bool grow_in_place(MatrixList* matrix, int32_t row_capacity, int32_t col_capacity) {
+    row_capacity = round_capacity(matrix->layout, row_capacity);
+    col_capacity = round_capacity(matrix->layout, col_capacity);
+    
+    int64_t new_capacity = (int64_t)row_capacity * col_capacity;
+    int32_t* new_data = (int32_t*)realloc_array(matrix->data, new_capacity, sizeof(int32_t));
+    
+    if (new_data == NULL) {
+        return false;
     }
     
-    memset(new_data, 0, sizeof(int32_t) * new_capacity);
+    matrix->data = new_data;
+    matrix->row_capacity = row_capacity;
+    matrix->col_capacity = col_capacity;
+    matrix->capacity = new_capacity;
+    return true;
+}
+
+static int32_t grown_capacity(MatrixList* matrix, int32_t capacity, int32_t required) {
+    int64_t grown = (int64_t)capacity * matrix->extend_ratio;
+    if (grown > INT32_MAX - MATRIX_TILE_SIZE) {
+        grown = INT32_MAX - MATRIX_TILE_SIZE;
+    }
+    return grown < required ? required : (int32_t)grown;
+}
+
+void extend_matrix(MatrixList* matrix, int32_t new_rows, int32_t new_cols) {
+    if (!is_matrix_writable(matrix) || new_rows <= 0 || new_cols <= 0) { 
+        return;
+    }
     
-    int32_t min_rows = matrix->rows < new_rows ? matrix->rows : new_rows;
-    int32_t min_cols = matrix->cols < new_cols ? matrix->cols : new_cols;
+    bool rows_exceed = new_rows > matrix->row_capacity;
+    bool cols_exceed = new_cols > matrix->col_capacity;
     
-    for (int32_t i = 0; i < min_rows; i++) {
-        for (int32_t j = 0; j < min_cols; j++) {
-            int32_t old_index = i * matrix->cols + j;
-            int32_t new_index = i * new_cols + j;
-            new_data[new_index] = matrix->data[old_index];
+    if (rows_exceed || cols_exceed) {
+        int32_t row_capacity = rows_exceed ? grown_capacity(matrix, matrix->row_capacity, new_rows) : matrix->row_capacity;
+        int32_t col_capacity = cols_exceed ? grown_capacity(matrix, matrix->col_capacity, new_cols) : matrix->col_capacity;
+        
+        bool in_place = matrix->storage == MATRIX_HEAP
+            && ((matrix->layout == MATRIX_COL_MAJOR) ? !rows_exceed : !cols_exceed);
+        bool grown = in_place
+            ? grow_in_place(matrix, row_capacity, col_capacity)
+            : relocate_matrix(matrix, matrix->layout, row_capacity, col_capacity);
+        
+        if (!grown) {
+            return;
         }
     }
     
-    free(matrix->data);
-    matrix->data = new_data;
+    int32_t kept_rows = matrix->rows < new_rows ? matrix->rows : new_rows;
+    
+    if (new_cols > matrix->cols) {
+        fill_region(matrix, 0, kept_rows, matrix->cols, new_cols, 0);
+    }
+    
+    fill_region(matrix, kept_rows, new_rows, 0, new_cols, 0);
+    
     matrix->rows = new_rows;
     matrix->cols = new_cols;
-    matrix->capacity = new_capacity;
 }
 
 void set_matrix(MatrixList* matrix, int32_t row, int32_t col, int32_t value) {
-    if (matrix == NULL || row < 0 || col < 0 || row >= matrix->rows || col >= matrix->cols) {
-        return;
+    try_set_matrix(matrix, row, col, value);
+}
+
+int32_t get_matrix(MatrixList* matrix, int32_t row, int32_t col) {
+    int32_t value = -1;
+    try_get_matrix(matrix, row, col, &value);
+    return value;
+}
+
+DsStatus try_set_matrix(MatrixList* matrix, int32_t row, int32_t col, int32_t value) {
+    if (matrix == NULL) {
+        return DS_NULL_POINTER;
+    }
+    if (row < 0 || col < 0 || row >= matrix->rows || col >= matrix->cols) {
+        return DS_OUT_OF_RANGE;
+    }
+    if (!is_matrix_writable(matrix)) {
+        return DS_READ_ONLY;
     }
     
-    int32_t index = get_index(matrix, row, col);
-    matrix->data[index] = value;
+    matrix_set_at(matrix, row, col, value);
+    return DS_OK;
 }
 
-int32_t get_matrix(MatrixList* matrix, int32_t row, int32_t col) {
-    if (matrix == NULL || row < 0 || col < 0 || row >= matrix->rows || col >= matrix->cols) {
-        return -1;
+DsStatus try_get_matrix(MatrixList* matrix, int32_t row, int32_t col, int32_t* value) {
+    if (matrix == NULL || value == NULL) {
+        return DS_NULL_POINTER;
+    }
+    if (row < 0 || col < 0 || row >= matrix->rows || col >= matrix->cols) {
+        return DS_OUT_OF_RANGE;
     }
     
-    int32_t index = get_index(matrix, row, col);
-    return matrix->data[index];
+    *value = matrix_at(matrix, row, col);
+    return DS_OK;
 }
 
 void print_matrix(MatrixList* matrix) {
-    if (matrix == NULL) {
+    OutputWriter* writer = new_output_writer(stdout);
+    write_matrix(matrix, writer);
+    delete_output_writer(writer);
+}
+
+void write_matrix(MatrixList* matrix, OutputWriter* writer) {
+    if (matrix == NULL || writer == NULL) {
+        return;
+    }
+    
+    int32_t* row_values = (int32_t*)malloc_array(matrix->cols, sizeof(int32_t));
+    if (row_values == NULL) {
         return;
     }
 
     for (int32_t i = 0; i < matrix->rows; i++) {
-        printf("  [");
+        get_row_values(matrix, i, 0, row_values, matrix->cols);
+        write_string(writer, "  [");
         for (int32_t j = 0; j < matrix->cols; j++) {
-            printf("%4d", get_matrix(matrix, i, j));
-            if (j < matrix->cols - 1) printf(", ");
+            write_int32_padded(writer, row_values[j], 4);
+            if (j < matrix->cols - 1) write_string(writer, ", ");
         }
-        printf("]\n");
+        write_string(writer, "]\n");
     }
+    
+    tracked_free(row_values);
 }
 
 void fill_matrix(MatrixList* matrix, int32_t value) {
-    if (matrix == NULL) {
+    if (!is_matrix_writable(matrix)) {
         return;
     }
     
-    for (int32_t i = 0; i < matrix->capacity; i++) {
-        matrix->data[i] = value;
-    }
+    fill_region(matrix, 0, matrix->rows, 0, matrix->cols, value);
 }
 
 void add_row(MatrixList* matrix) {
@@ -128,19 +316,117 @@ void add_col(MatrixList* matrix) {
     extend_matrix(matrix, matrix->rows, matrix->cols + 1);
 }
 
+static bool is_row_range_valid(MatrixList* matrix, int32_t row, int32_t col, int32_t count) {
+    return matrix != NULL && row >= 0 && row < matrix->rows
+        && col >= 0 && count >= 0 && count <= matrix->cols - col;
+}
+
+bool set_row_values(MatrixList* matrix, int32_t row, int32_t col, const int32_t* values, int32_t count) {
+    if (!is_matrix_writable(matrix) || !is_row_range_valid(matrix, row, col, count) || (values == NULL && count > 0)) {
+        return false;
+    }
+    
+    if (matrix->layout == MATRIX_ROW_MAJOR) {
+        if (count > 0) {
+            memcpy(&matrix->data[matrix_cell_index(matrix, row, col)], values, sizeof(int32_t) * count);
+        }
+        return true;
+    }
+    
+    visit_runs(matrix, row, row + 1, col, col + count, [&values](int32_t* cells, int64_t run) {
+        memcpy(cells, values, sizeof(int32_t) * run);
+        values += run;
+        return true;
+    });
+    return true;
+}
+
+bool get_row_values(MatrixList* matrix, int32_t row, int32_t col, int32_t* values, int32_t count) {
+    if (!is_row_range_valid(matrix, row, col, count) || (values == NULL && count > 0)) {
+        return false;
+    }
+    
+    if (matrix->layout == MATRIX_ROW_MAJOR) {
+        if (count > 0) {
+            memcpy(values, &matrix->data[matrix_cell_index(matrix, row, col)], sizeof(int32_t) * count);
+        }
+        return true;
+    }
+    
+    visit_runs(matrix, row, row + 1, col, col + count, [&values](int32_t* cells, int64_t run) {
+        memcpy(values, cells, sizeof(int32_t) * run);
+        values += run;
+        return true;
+    });
+    return true;
+}
+
+bool copy_row_block(MatrixList* matrix, int32_t src_row, int32_t dst_row, int32_t row_count, int32_t col_offset) {
+    if (!is_matrix_writable(matrix) || row_count < 0 || src_row < 0 || dst_row < 0
+        || row_count > matrix->rows - src_row || row_count > matrix->rows - dst_row
+        || col_offset < 0 || col_offset >= matrix->cols) {
+        return false;
+    }
+    
+    if (row_count == 0 || (src_row == dst_row && col_offset == 0)) {
+        return true;
+    }
+    
+    int32_t width = matrix->cols - col_offset;
+    
+    if (matrix->layout == MATRIX_ROW_MAJOR && col_offset == 0) {
+        memmove(&matrix->data[matrix_cell_index(matrix, dst_row, 0)], &matrix->data[matrix_cell_index(matrix, src_row, 0)],
+                sizeof(int32_t) * ((int64_t)(row_count - 1) * matrix->col_capacity + matrix->cols));
+        return true;
+    }
+    
+    int32_t step = (dst_row > src_row) ? -1 : 1;
+    int32_t first = (step > 0) ? 0 : row_count - 1;
+    
+    for (int32_t k = 0, i = first; k < row_count; ++k, i += step) {
+        if (matrix->layout == MATRIX_ROW_MAJOR) {
+            memmove(&matrix->data[matrix_cell_index(matrix, dst_row + i, col_offset)],
+                    &matrix->data[matrix_cell_index(matrix, src_row + i, 0)], sizeof(int32_t) * width);
+            continue;
+        }
+        
+        for (int32_t j = width - 1; j >= 0; --j) {
+            matrix->data[matrix_cell_index(matrix, dst_row + i, j + col_offset)] = matrix->data[matrix_cell_index(matrix, src_row + i, j)];
+        }
+    }
+    return true;
+}
+
+bool fill_row_range(MatrixList* matrix, int32_t row_begin, int32_t row_end, int32_t col_begin, int32_t col_end, int32_t value) {
+    if (!is_matrix_writable(matrix) || row_begin < 0 || col_begin < 0
+        || row_begin > row_end || col_begin > col_end || row_end > matrix->rows || col_end > matrix->cols) {
+        return false;
+    }
+    
+    if (row_begin < row_end && col_begin < col_end) {
+        fill_region(matrix, row_begin, row_end, col_begin, col_end, value);
+    }
+    return true;
+}
+
 int32_t* get_row_array(MatrixList* matrix, int32_t row) {
     if (matrix == NULL || row < 0 || row >= matrix->rows) {
         return NULL;
     }
     
-    int32_t* row_array = (int32_t*)malloc(sizeof(int32_t) * matrix->cols);
+    int32_t* row_array = (int32_t*)malloc_array(matrix->cols, sizeof(int32_t));
     if (row_array == NULL) return NULL;
     
-    for (int32_t j = 0; j < matrix->cols; j++) {
-        row_array[j] = get_matrix(matrix, row, j);
+    get_row_values(matrix, row, 0, row_array, matrix->cols);
+    return row_array;
+}
+
+int32_t* get_row_pointer(MatrixList* matrix, int32_t row) {
+    if (matrix == NULL || matrix->layout != MATRIX_ROW_MAJOR || row < 0 || row >= matrix->rows) {
+        return NULL;
     }
     
-    return row_array;
+    return &matrix->data[matrix_cell_index(matrix, row, 0)];
 }
 
 int32_t* get_col_array(MatrixList* matrix, int32_t col) {
@@ -148,12 +434,309 @@ int32_t* get_col_array(MatrixList* matrix, int32_t col) {
         return NULL;
     }
     
-    int32_t* col_array = (int32_t*)malloc(sizeof(int32_t) * matrix->rows);
+    int32_t* col_array = (int32_t*)malloc_array(matrix->rows, sizeof(int32_t));
     if (col_array == NULL) return NULL;
     
+    if (matrix->layout == MATRIX_COL_MAJOR) {
+        memcpy(col_array, &matrix->data[matrix_cell_index(matrix, 0, col)], sizeof(int32_t) * matrix->rows);
+        return col_array;
+    }
+    
     for (int32_t i = 0; i < matrix->rows; i++) {
-        col_array[i] = get_matrix(matrix, i, col);
+        col_array[i] = matrix->data[matrix_cell_index(matrix, i, col)];
     }
     
     return col_array;
-}
\ No newline at end of file
+}
+
+bool convert_matrix_layout(MatrixList* matrix, MatrixLayout layout) {
+    if (!is_matrix_writable(matrix)) {
+        return false;
+    }
+    
+    if (matrix->layout == layout) {
+        return true;
+    }
+    
+    return relocate_matrix(matrix, layout, matrix->row_capacity, matrix->col_capacity);
+}
+
+bool is_matrix_writable(MatrixList* matrix) {
+    return matrix != NULL && matrix->storage != MATRIX_MAPPED_READ_ONLY;
+}
+
+static bool write_all(FILE* file, const void* data, size_t bytes) {
+    return bytes == 0 || fwrite(data, 1, bytes, file) == bytes;
+}
+
+bool save_matrix(MatrixList* matrix, const char* path) {
+    if (matrix == NULL || path == NULL) {
+        return false;
+    }
+    
+    int32_t row_capacity = round_capacity(matrix->layout, matrix->rows);
+    int32_t col_capacity = round_capacity(matrix->layout, matrix->cols);
+    int64_t count = (int64_t)row_capacity * col_capacity;
+    
+    const int32_t* data = matrix->data;
+    int32_t* compact = NULL;
+    
+    if (row_capacity != matrix->row_capacity || col_capacity != matrix->col_capacity) {
+        compact = (int32_t*)calloc_array(count, sizeof(int32_t));
+        if (compact == NULL) {
+            return false;
+        }
+        copy_region(matrix, compact, matrix->layout, row_capacity, col_capacity, matrix->rows, matrix->cols);
+        data = compact;
+    }
+    
+    MatrixFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = MATRIX_FILE_MAGIC;
+    header.version = MATRIX_FILE_VERSION;
+    header.dtype = MATRIX_DTYPE_INT32;
+    header.layout = (uint32_t)matrix->layout;
+    header.rows = matrix->rows;
+    header.cols = matrix->cols;
+    header.row_capacity = row_capacity;
+    header.col_capacity = col_capacity;
+    header.data_offset = MATRIX_FILE_DATA_OFFSET;
+    header.data_size = sizeof(int32_t) * (uint64_t)count;
+    
+    size_t path_length = strlen(path);
+    char* temp_path = (char*)tracked_malloc(path_length + 5);
+    if (temp_path == NULL) {
+        tracked_free(compact);
+        return false;
+    }
+    memcpy(temp_path, path, path_length);
+    memcpy(&temp_path[path_length], ".tmp", 5);
+    
+    unsigned char padding[MATRIX_FILE_DATA_OFFSET];
+    memset(padding, 0, sizeof(padding));
+    
+    FILE* file = fopen(temp_path, "wb");
+    bool written = file != NULL
+        && write_all(file, &header, sizeof(header))
+        && write_all(file, padding, MATRIX_FILE_DATA_OFFSET - sizeof(header))
+        && write_all(file, data, header.data_size);
+    
+    if (file != NULL && fclose(file) != 0) {
+        written = false;
+    }
+    
+    if (written) {
+        written = rename(temp_path, path) == 0;
+    }
+    if (!written) {
+        remove(temp_path);
+    }
+    
+    tracked_free(temp_path);
+    tracked_free(compact);
+    return written;
+}
+
+static bool is_valid_header(const MatrixFileHeader* header, size_t file_size) {
+    if (header->magic != MATRIX_FILE_MAGIC || header->version != MATRIX_FILE_VERSION
+        || header->dtype != MATRIX_DTYPE_INT32 || header->layout > MATRIX_TILED) {
+        return false;
+    }
+    
+    if (header->rows <= 0 || header->cols <= 0
+        || header->row_capacity < header->rows || header->col_capacity < header->cols) {
+        return false;
+    }
+    
+    MatrixLayout layout = (MatrixLayout)header->layout;
+    if (round_capacity(layout, header->row_capacity) != header->row_capacity
+        || round_capacity(layout, header->col_capacity) != header->col_capacity) {
+        return false;
+    }
+    
+    size_t data_size = 0;
+    if (!checked_array_bytes((int64_t)header->row_capacity * header->col_capacity, sizeof(int32_t), &data_size)) {
+        return false;
+    }
+    
+    return header->data_offset == MATRIX_FILE_DATA_OFFSET
+        && header->data_size == data_size
+        && header->data_offset + header->data_size <= file_size;
+}
+
+MatrixList* map_matrix(const char* path, MatrixMapMode mode) {
+    if (path == NULL) {
+        return NULL;
+    }
+    
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(MatrixFileHeader)) {
+        close(fd);
+        return NULL;
+    }
+    
+    size_t mapping_size = (size_t)info.st_size;
+    int protection = (mode == MATRIX_MAP_READ_ONLY) ? PROT_READ : PROT_READ | PROT_WRITE;
+    int flags = (mode == MATRIX_MAP_READ_ONLY) ? MAP_SHARED : MAP_PRIVATE;
+    void* mapping = mmap(NULL, mapping_size, protection, flags, fd, 0);
+    close(fd);
+    
+    if (mapping == MAP_FAILED) {
+        return NULL;
+    }
+    
+    const MatrixFileHeader* header = (const MatrixFileHeader*)mapping;
+    MatrixList* matrix = is_valid_header(header, mapping_size) ? (MatrixList*)tracked_malloc(sizeof(MatrixList)) : NULL;
+    if (matrix == NULL) {
+        munmap(mapping, mapping_size);
+        return NULL;
+    }
+    
+    matrix->data = (int32_t*)((unsigned char*)mapping + header->data_offset);
+    matrix->storage = (mode == MATRIX_MAP_READ_ONLY) ? MATRIX_MAPPED_READ_ONLY : MATRIX_MAPPED_COPY_ON_WRITE;
+    matrix->mapping = mapping;
+    matrix->mapping_size = mapping_size;
+    matrix->layout = (MatrixLayout)header->layout;
+    matrix->rows = header->rows;
+    matrix->cols = header->cols;
+    matrix->row_capacity = header->row_capacity;
+    matrix->col_capacity = header->col_capacity;
+    matrix->capacity = (int64_t)header->row_capacity * header->col_capacity;
+    matrix->extend_ratio = 2;
+    
+    return matrix;
+}
+
+int32_t find_in_row(MatrixList* matrix, int32_t row, int32_t value) {
+    if (matrix == NULL || row < 0 || row >= matrix->rows) {
+        return -1;
+    }
+    
+    if (matrix->layout == MATRIX_ROW_MAJOR) {
+        return (int32_t)simd_find_i32(&matrix->data[matrix_cell_index(matrix, row, 0)], matrix->cols, value);
+    }
+    
+    for (int32_t j = 0; j < matrix->cols; j++) {
+        if (matrix->data[matrix_cell_index(matrix, row, j)] == value) {
+            return j;
+        }
+    }
+    return -1;
+}
+
+int32_t count_row(MatrixList* matrix, int32_t row, int32_t value) {
+    if (matrix == NULL || row < 0 || row >= matrix->rows) {
+        return 0;
+    }
+    
+    int64_t total = 0;
+    visit_runs(matrix, row, row + 1, 0, matrix->cols, [&total, value](int32_t* cells, int64_t count) {
+        total += simd_count_i32(cells, count, value);
+        return true;
+    });
+    return (int32_t)total;
+}
+
+bool min_row(MatrixList* matrix, int32_t row, int32_t* value) {
+    if (matrix == NULL || row < 0 || row >= matrix->rows) {
+        return false;
+    }
+    
+    int32_t best = INT32_MAX;
+    visit_runs(matrix, row, row + 1, 0, matrix->cols, [&best](int32_t* cells, int64_t count) {
+        int32_t current = simd_min_i32(cells, count);
+        if (current < best) best = current;
+        return true;
+    });
+    *value = best;
+    return true;
+}
+
+bool max_row(MatrixList* matrix, int32_t row, int32_t* value) {
+    if (matrix == NULL || row < 0 || row >= matrix->rows) {
+        return false;
+    }
+    
+    int32_t best = INT32_MIN;
+    visit_runs(matrix, row, row + 1, 0, matrix->cols, [&best](int32_t* cells, int64_t count) {
+        int32_t current = simd_max_i32(cells, count);
+        if (current > best) best = current;
+        return true;
+    });
+    *value = best;
+    return true;
+}
+
+int64_t sum_row(MatrixList* matrix, int32_t row) {
+    if (matrix == NULL || row < 0 || row >= matrix->rows) {
+        return 0;
+    }
+    
+    int64_t total = 0;
+    visit_runs(matrix, row, row + 1, 0, matrix->cols, [&total](int32_t* cells, int64_t count) {
+        total += simd_sum_i32(cells, count);
+        return true;
+    });
+    return total;
+}
+
+int64_t count_matrix(MatrixList* matrix, int32_t value) {
+    if (matrix == NULL) {
+        return 0;
+    }
+    
+    int64_t total = 0;
+    visit_runs(matrix, 0, matrix->rows, 0, matrix->cols, [&total, value](int32_t* cells, int64_t count) {
+        total += simd_count_i32(cells, count, value);
+        return true;
+    });
+    return total;
+}
+
+bool min_matrix(MatrixList* matrix, int32_t* value) {
+    if (matrix == NULL) {
+        return false;
+    }
+    
+    int32_t best = INT32_MAX;
+    visit_runs(matrix, 0, matrix->rows, 0, matrix->cols, [&best](int32_t* cells, int64_t count) {
+        int32_t current = simd_min_i32(cells, count);
+        if (current < best) best = current;
+        return true;
+    });
+    *value = best;
+    return true;
+}
+
+bool max_matrix(MatrixList* matrix, int32_t* value) {
+    if (matrix == NULL) {
+        return false;
+    }
+    
+    int32_t best = INT32_MIN;
+    visit_runs(matrix, 0, matrix->rows, 0, matrix->cols, [&best](int32_t* cells, int64_t count) {
+        int32_t current = simd_max_i32(cells, count);
+        if (current > best) best = current;
+        return true;
+    });
+    *value = best;
+    return true;
+}
+
+int64_t sum_matrix(MatrixList* matrix) {
+    if (matrix == NULL) {
+        return 0;
+    }
+    
+    int64_t total = 0;
+    visit_runs(matrix, 0, matrix->rows, 0, matrix->cols, [&total](int32_t* cells, int64_t count) {
+        total += simd_sum_i32(cells, count);
+        return true;
+    });
+    return total;
+}
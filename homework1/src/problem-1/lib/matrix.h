@@ -6,16 +6,96 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include "./access.h"
+#include "./alloc.h"
+#include "./simd.h"
+#include "./writer.h"
+
+#define MATRIX_TILE_SIZE 8
+
+typedef enum {
+    MATRIX_ROW_MAJOR,
+    MATRIX_COL_MAJOR,
+    MATRIX_TILED
+} MatrixLayout;
+
+typedef enum {
+    MATRIX_HEAP,
+    MATRIX_MAPPED_READ_ONLY,
+    MATRIX_MAPPED_COPY_ON_WRITE
+} MatrixStorage;
+
+typedef enum {
+    MATRIX_MAP_READ_ONLY,
+    MATRIX_MAP_COPY_ON_WRITE
+} MatrixMapMode;
+
+#define MATRIX_FILE_MAGIC 0x4C58544Du
+#define MATRIX_FILE_VERSION 1
+#define MATRIX_FILE_DATA_OFFSET 64
+#define MATRIX_DTYPE_INT32 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t dtype;
+    uint32_t layout;
+    int32_t rows;
+    int32_t cols;
+    int32_t row_capacity;
+    int32_t col_capacity;
+    uint64_t data_offset;
+    uint64_t data_size;
+} MatrixFileHeader;
 
 typedef struct {
     int32_t *data;
+    MatrixStorage storage;
+    void* mapping;
+    size_t mapping_size;
+    MatrixLayout layout;
     int32_t rows; 
     int32_t cols; 
-    int32_t capacity;
+    int32_t row_capacity;
+    int32_t col_capacity;
+    int64_t capacity;
     int32_t extend_ratio;
 } MatrixList;
 
-MatrixList* new_matrix(int32_t rows, int32_t cols);
+static inline int64_t matrix_index_for(MatrixLayout layout, int32_t row_capacity, int32_t col_capacity, int32_t row, int32_t col) {
+    switch (layout) {
+        case MATRIX_COL_MAJOR:
+            return (int64_t)col * row_capacity + row;
+        case MATRIX_TILED: {
+            int64_t tile = (int64_t)(row / MATRIX_TILE_SIZE) * (col_capacity / MATRIX_TILE_SIZE) + col / MATRIX_TILE_SIZE;
+            return tile * MATRIX_TILE_SIZE * MATRIX_TILE_SIZE
+                 + (row % MATRIX_TILE_SIZE) * MATRIX_TILE_SIZE + col % MATRIX_TILE_SIZE;
+        }
+        default:
+            return (int64_t)row * col_capacity + col;
+    }
+}
+
+static inline int64_t matrix_cell_index(const MatrixList* matrix, int32_t row, int32_t col) {
+    if (matrix->layout == MATRIX_ROW_MAJOR) {
+        return (int64_t)row * matrix->col_capacity + col;
+    }
+    
+    return matrix_index_for(matrix->layout, matrix->row_capacity, matrix->col_capacity, row, col);
+}
+
+static inline int32_t matrix_at(const MatrixList* matrix, int32_t row, int32_t col) {
+    DS_CHECK_ACCESS(matrix != NULL && row >= 0 && col >= 0 && row < matrix->rows && col < matrix->cols);
+    return matrix->data[matrix_cell_index(matrix, row, col)];
+}
+
+static inline void matrix_set_at(MatrixList* matrix, int32_t row, int32_t col, int32_t value) {
+    DS_CHECK_ACCESS(matrix != NULL && row >= 0 && col >= 0 && row < matrix->rows && col < matrix->cols);
+    DS_CHECK_ACCESS(matrix->storage != MATRIX_MAPPED_READ_ONLY);
+    matrix->data[matrix_cell_index(matrix, row, col)] = value;
+}
+
+MatrixList* new_matrix(int32_t rows, int32_t cols, MatrixLayout layout = MATRIX_ROW_MAJOR);
 
 void delete_matrix(MatrixList* matrix);
 
@@ -25,16 +105,58 @@ void set_matrix(MatrixList* matrix, int32_t row, int32_t col, int32_t value);
 
 int32_t get_matrix(MatrixList* matrix, int32_t row, int32_t col);
 
+DsStatus try_set_matrix(MatrixList* matrix, int32_t row, int32_t col, int32_t value);
+
+DsStatus try_get_matrix(MatrixList* matrix, int32_t row, int32_t col, int32_t* value);
+
 void print_matrix(MatrixList* matrix);
 
+void write_matrix(MatrixList* matrix, OutputWriter* writer);
+
 void fill_matrix(MatrixList* matrix, int32_t value);
 
 void add_row(MatrixList* matrix);
 
 void add_col(MatrixList* matrix);
 
+bool set_row_values(MatrixList* matrix, int32_t row, int32_t col, const int32_t* values, int32_t count);
+
+bool get_row_values(MatrixList* matrix, int32_t row, int32_t col, int32_t* values, int32_t count);
+
+bool copy_row_block(MatrixList* matrix, int32_t src_row, int32_t dst_row, int32_t row_count, int32_t col_offset = 0);
+
+bool fill_row_range(MatrixList* matrix, int32_t row_begin, int32_t row_end, int32_t col_begin, int32_t col_end, int32_t value);
+
 int32_t* get_row_array(MatrixList* matrix, int32_t row);
 
+int32_t* get_row_pointer(MatrixList* matrix, int32_t row);
+
 int32_t* get_col_array(MatrixList* matrix, int32_t col);
 
+bool convert_matrix_layout(MatrixList* matrix, MatrixLayout layout);
+
+bool save_matrix(MatrixList* matrix, const char* path);
+
+MatrixList* map_matrix(const char* path, MatrixMapMode mode);
+
+bool is_matrix_writable(MatrixList* matrix);
+
+int32_t find_in_row(MatrixList* matrix, int32_t row, int32_t value);
+
+int32_t count_row(MatrixList* matrix, int32_t row, int32_t value);
+
+bool min_row(MatrixList* matrix, int32_t row, int32_t* value);
+
+bool max_row(MatrixList* matrix, int32_t row, int32_t* value);
+
+int64_t sum_row(MatrixList* matrix, int32_t row);
+
+int64_t count_matrix(MatrixList* matrix, int32_t value);
+
+bool min_matrix(MatrixList* matrix, int32_t* value);
+
+bool max_matrix(MatrixList* matrix, int32_t* value);
+
+int64_t sum_matrix(MatrixList* matrix);
+
 #endif
\ No newline at end of file
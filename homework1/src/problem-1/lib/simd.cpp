@@ -0,0 +1,417 @@
+#include "./simd.h"
+#include <atomic>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+#define COUNT_FLUSH ((int64_t)1 << 20)
+
+static int64_t find_scalar(const int32_t* data, int64_t count, int32_t value) {
+    for (int64_t i = 0; i < count; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int64_t count_scalar(const int32_t* data, int64_t count, int32_t value) {
+    int64_t total = 0;
+    for (int64_t i = 0; i < count; ++i) {
+        total += (data[i] == value);
+    }
+    return total;
+}
+
+static void fill_scalar(int32_t* data, int64_t count, int32_t value) {
+    for (int64_t i = 0; i < count; ++i) {
+        data[i] = value;
+    }
+}
+
+static int32_t min_scalar(const int32_t* data, int64_t count) {
+    int32_t result = data[0];
+    for (int64_t i = 1; i < count; ++i) {
+        if (data[i] < result) result = data[i];
+    }
+    return result;
+}
+
+static int32_t max_scalar(const int32_t* data, int64_t count) {
+    int32_t result = data[0];
+    for (int64_t i = 1; i < count; ++i) {
+        if (data[i] > result) result = data[i];
+    }
+    return result;
+}
+
+static int64_t sum_scalar(const int32_t* data, int64_t count) {
+    int64_t total = 0;
+    for (int64_t i = 0; i < count; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+#ifdef SIMD_X86
+
+static int64_t find_sse2(const int32_t* data, int64_t count, int32_t value) {
+    __m128i needle = _mm_set1_epi32(value);
+    int64_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i block = _mm_loadu_si128((const __m128i*)&data[i]);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    
+    int64_t tail = find_scalar(&data[i], count - i, value);
+    return tail < 0 ? -1 : i + tail;
+}
+
+static int64_t count_sse2(const int32_t* data, int64_t count, int32_t value) {
+    __m128i needle = _mm_set1_epi32(value);
+    int64_t total = 0;
+    int64_t i = 0;
+    
+    while (i + 4 <= count) {
+        __m128i matches = _mm_setzero_si128();
+        int64_t block_end = (count - i > COUNT_FLUSH) ? i + COUNT_FLUSH : count;
+        
+        for (; i + 4 <= block_end; i += 4) {
+            __m128i block = _mm_loadu_si128((const __m128i*)&data[i]);
+            matches = _mm_sub_epi32(matches, _mm_cmpeq_epi32(block, needle));
+        }
+        
+        int32_t lanes[4];
+        _mm_storeu_si128((__m128i*)lanes, matches);
+        total += (int64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+    
+    return total + count_scalar(&data[i], count - i, value);
+}
+
+static void fill_sse2(int32_t* data, int64_t count, int32_t value) {
+    __m128i fill = _mm_set1_epi32(value);
+    int64_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128((__m128i*)&data[i], fill);
+    }
+    
+    fill_scalar(&data[i], count - i, value);
+}
+
+static __m128i select_sse2(__m128i take_a, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(take_a, a), _mm_andnot_si128(take_a, b));
+}
+
+static int32_t min_sse2(const int32_t* data, int64_t count) {
+    if (count < 4) {
+        return min_scalar(data, count);
+    }
+    
+    __m128i result = _mm_loadu_si128((const __m128i*)data);
+    int64_t i = 4;
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i block = _mm_loadu_si128((const __m128i*)&data[i]);
+        result = select_sse2(_mm_cmplt_epi32(block, result), block, result);
+    }
+    
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, result);
+    int32_t best = min_scalar(lanes, 4);
+    
+    if (i < count) {
+        int32_t tail = min_scalar(&data[i], count - i);
+        if (tail < best) best = tail;
+    }
+    return best;
+}
+
+static int32_t max_sse2(const int32_t* data, int64_t count) {
+    if (count < 4) {
+        return max_scalar(data, count);
+    }
+    
+    __m128i result = _mm_loadu_si128((const __m128i*)data);
+    int64_t i = 4;
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i block = _mm_loadu_si128((const __m128i*)&data[i]);
+        result = select_sse2(_mm_cmpgt_epi32(block, result), block, result);
+    }
+    
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, result);
+    int32_t best = max_scalar(lanes, 4);
+    
+    if (i < count) {
+        int32_t tail = max_scalar(&data[i], count - i);
+        if (tail > best) best = tail;
+    }
+    return best;
+}
+
+static int64_t sum_sse2(const int32_t* data, int64_t count) {
+    __m128i low = _mm_setzero_si128();
+    __m128i high = _mm_setzero_si128();
+    int64_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i block = _mm_loadu_si128((const __m128i*)&data[i]);
+        __m128i sign = _mm_srai_epi32(block, 31);
+        low = _mm_add_epi64(low, _mm_unpacklo_epi32(block, sign));
+        high = _mm_add_epi64(high, _mm_unpackhi_epi32(block, sign));
+    }
+    
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, _mm_add_epi64(low, high));
+    return lanes[0] + lanes[1] + sum_scalar(&data[i], count - i);
+}
+
+__attribute__((target("avx2")))
+static int64_t find_avx2(const int32_t* data, int64_t count, int32_t value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    int64_t i = 0;
+    
+    for (; i + 8 <= count; i += 8) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)&data[i]);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    
+    int64_t tail = find_scalar(&data[i], count - i, value);
+    return tail < 0 ? -1 : i + tail;
+}
+
+__attribute__((target("avx2")))
+static int64_t count_avx2(const int32_t* data, int64_t count, int32_t value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    int64_t total = 0;
+    int64_t i = 0;
+    
+    while (i + 8 <= count) {
+        __m256i matches = _mm256_setzero_si256();
+        int64_t block_end = (count - i > COUNT_FLUSH) ? i + COUNT_FLUSH : count;
+        
+        for (; i + 8 <= block_end; i += 8) {
+            __m256i block = _mm256_loadu_si256((const __m256i*)&data[i]);
+            matches = _mm256_sub_epi32(matches, _mm256_cmpeq_epi32(block, needle));
+        }
+        
+        int32_t lanes[8];
+        _mm256_storeu_si256((__m256i*)lanes, matches);
+        for (int32_t k = 0; k < 8; ++k) {
+            total += lanes[k];
+        }
+    }
+    
+    return total + count_scalar(&data[i], count - i, value);
+}
+
+__attribute__((target("avx2")))
+static void fill_avx2(int32_t* data, int64_t count, int32_t value) {
+    __m256i fill = _mm256_set1_epi32(value);
+    int64_t i = 0;
+    
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256((__m256i*)&data[i], fill);
+    }
+    
+    fill_scalar(&data[i], count - i, value);
+}
+
+__attribute__((target("avx2")))
+static int32_t min_avx2(const int32_t* data, int64_t count) {
+    if (count < 8) {
+        return min_scalar(data, count);
+    }
+    
+    __m256i result = _mm256_loadu_si256((const __m256i*)data);
+    int64_t i = 8;
+    
+    for (; i + 8 <= count; i += 8) {
+        result = _mm256_min_epi32(result, _mm256_loadu_si256((const __m256i*)&data[i]));
+    }
+    
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, result);
+    int32_t best = min_scalar(lanes, 8);
+    
+    if (i < count) {
+        int32_t tail = min_scalar(&data[i], count - i);
+        if (tail < best) best = tail;
+    }
+    return best;
+}
+
+__attribute__((target("avx2")))
+static int32_t max_avx2(const int32_t* data, int64_t count) {
+    if (count < 8) {
+        return max_scalar(data, count);
+    }
+    
+    __m256i result = _mm256_loadu_si256((const __m256i*)data);
+    int64_t i = 8;
+    
+    for (; i + 8 <= count; i += 8) {
+        result = _mm256_max_epi32(result, _mm256_loadu_si256((const __m256i*)&data[i]));
+    }
+    
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, result);
+    int32_t best = max_scalar(lanes, 8);
+    
+    if (i < count) {
+        int32_t tail = max_scalar(&data[i], count - i);
+        if (tail > best) best = tail;
+    }
+    return best;
+}
+
+__attribute__((target("avx2")))
+static int64_t sum_avx2(const int32_t* data, int64_t count) {
+    __m256i low = _mm256_setzero_si256();
+    __m256i high = _mm256_setzero_si256();
+    int64_t i = 0;
+    
+    for (; i + 8 <= count; i += 8) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)&data[i]);
+        low = _mm256_add_epi64(low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+        high = _mm256_add_epi64(high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+    }
+    
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(low, high));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(&data[i], count - i);
+}
+
+#endif
+
+#define SIMD_UNRESOLVED -1
+
+static std::atomic<int> active_backend(SIMD_UNRESOLVED);
+
+SimdBackend simd_detect_backend() {
+#ifdef SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SIMD_SSE2;
+    }
+#endif
+    return SIMD_SCALAR;
+}
+
+SimdBackend simd_backend() {
+    int backend = active_backend.load(std::memory_order_acquire);
+    if (backend == SIMD_UNRESOLVED) {
+        int detected = simd_detect_backend();
+        if (active_backend.compare_exchange_strong(backend, detected, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            backend = detected;
+        }
+    }
+    return (SimdBackend)backend;
+}
+
+bool simd_set_backend(SimdBackend backend) {
+    if (backend > simd_detect_backend()) {
+        return false;
+    }
+    
+    active_backend.store(backend, std::memory_order_release);
+    return true;
+}
+
+const char* simd_backend_name(SimdBackend backend) {
+    switch (backend) {
+        case SIMD_AVX2:
+            return "avx2";
+        case SIMD_SSE2:
+            return "sse2";
+        default:
+            return "scalar";
+    }
+}
+
+int64_t simd_find_i32(const int32_t* data, int64_t count, int32_t value) {
+    if (data == NULL || count <= 0) return -1;
+#ifdef SIMD_X86
+    switch (simd_backend()) {
+        case SIMD_AVX2: return find_avx2(data, count, value);
+        case SIMD_SSE2: return find_sse2(data, count, value);
+        default: break;
+    }
+#endif
+    return find_scalar(data, count, value);
+}
+
+int64_t simd_count_i32(const int32_t* data, int64_t count, int32_t value) {
+    if (data == NULL || count <= 0) return 0;
+#ifdef SIMD_X86
+    switch (simd_backend()) {
+        case SIMD_AVX2: return count_avx2(data, count, value);
+        case SIMD_SSE2: return count_sse2(data, count, value);
+        default: break;
+    }
+#endif
+    return count_scalar(data, count, value);
+}
+
+void simd_fill_i32(int32_t* data, int64_t count, int32_t value) {
+    if (data == NULL || count <= 0) return;
+#ifdef SIMD_X86
+    switch (simd_backend()) {
+        case SIMD_AVX2: fill_avx2(data, count, value); return;
+        case SIMD_SSE2: fill_sse2(data, count, value); return;
+        default: break;
+    }
+#endif
+    fill_scalar(data, count, value);
+}
+
+int32_t simd_min_i32(const int32_t* data, int64_t count) {
+    if (data == NULL || count <= 0) return INT32_MAX;
+#ifdef SIMD_X86
+    switch (simd_backend()) {
+        case SIMD_AVX2: return min_avx2(data, count);
+        case SIMD_SSE2: return min_sse2(data, count);
+        default: break;
+    }
+#endif
+    return min_scalar(data, count);
+}
+
+int32_t simd_max_i32(const int32_t* data, int64_t count) {
+    if (data == NULL || count <= 0) return INT32_MIN;
+#ifdef SIMD_X86
+    switch (simd_backend()) {
+        case SIMD_AVX2: return max_avx2(data, count);
+        case SIMD_SSE2: return max_sse2(data, count);
+        default: break;
+    }
+#endif
+    return max_scalar(data, count);
+}
+
+int64_t simd_sum_i32(const int32_t* data, int64_t count) {
+    if (data == NULL || count <= 0) return 0;
+#ifdef SIMD_X86
+    switch (simd_backend()) {
+        case SIMD_AVX2: return sum_avx2(data, count);
+        case SIMD_SSE2: return sum_sse2(data, count);
+        default: break;
+    }
+#endif
+    return sum_scalar(data, count);
+}
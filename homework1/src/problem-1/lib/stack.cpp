@@ -0,0 +1,96 @@
+#include "./stack.h"
+
+static FrameSegment* new_segment(FrameSegment* prev, int64_t capacity) {
+    FrameSegment* segment = (FrameSegment*)tracked_malloc(sizeof(FrameSegment));
+    if (segment == NULL) {
+        return NULL;
+    }
+    
+    segment->frames = (AckermannFrame*)tracked_malloc(sizeof(AckermannFrame) * capacity);
+    if (segment->frames == NULL) {
+        tracked_free(segment);
+        return NULL;
+    }
+    
+    segment->prev = prev;
+    segment->next = NULL;
+    segment->capacity = capacity;
+    return segment;
+}
+
+static void delete_segment(FrameSegment* segment) {
+    if (segment != NULL) {
+        tracked_free(segment->frames);
+        tracked_free(segment);
+    }
+}
+
+FrameStack* new_frame_stack() {
+    FrameStack* stack = (FrameStack*)tracked_malloc(sizeof(FrameStack));
+    if (stack == NULL) {
+        return NULL;
+    }
+    
+    stack->current = new_segment(NULL, MIN_SEGMENT_FRAMES);
+    if (stack->current == NULL) {
+        tracked_free(stack);
+        return NULL;
+    }
+    
+    stack->top = 0;
+    stack->size = 0;
+    stack->max_size = MAX_STACK_FRAMES;
+    return stack;
+}
+
+void delete_frame_stack(FrameStack* stack) {
+    if (stack == NULL) {
+        return;
+    }
+    
+    FrameSegment* spare = stack->current->next;
+    while (spare != NULL) {
+        FrameSegment* next = spare->next;
+        delete_segment(spare);
+        spare = next;
+    }
+    
+    FrameSegment* segment = stack->current;
+    while (segment != NULL) {
+        FrameSegment* prev = segment->prev;
+        delete_segment(segment);
+        segment = prev;
+    }
+    
+    tracked_free(stack);
+}
+
+bool advance_frame_segment(FrameStack* stack) {
+    FrameSegment* next = stack->current->next;
+    
+    if (next == NULL) {
+        int64_t capacity = stack->current->capacity * 2;
+        if (capacity > MAX_SEGMENT_FRAMES) {
+            capacity = MAX_SEGMENT_FRAMES;
+        }
+        
+        next = new_segment(stack->current, capacity);
+        if (next == NULL) {
+            return false;
+        }
+        stack->current->next = next;
+    }
+    
+    stack->current = next;
+    stack->top = 0;
+    return true;
+}
+
+int64_t frame_stack_size(FrameStack* stack) {
+    if (stack == NULL) return 0;
+    return stack->size;
+}
+
+bool is_frame_stack_empty(FrameStack* stack) {
+    return stack == NULL || stack->size == 0;
+}
@@ -0,0 +1,90 @@
+#ifndef STACK_H
+#define STACK_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "./alloc.h"
+
+#define MIN_SEGMENT_FRAMES 256
+#define MAX_SEGMENT_FRAMES (1 << 20)
+#define MAX_STACK_FRAMES 2147483647
+
+typedef struct {
+    int32_t m;
+    int32_t n;
+} AckermannFrame;
+
+typedef struct FrameSegment {
+    struct FrameSegment* prev;
+    struct FrameSegment* next;
+    int64_t capacity;
+    AckermannFrame* frames;
+} FrameSegment;
+
+typedef struct {
+    FrameSegment* current;
+    int64_t top;
+    int64_t size;
+    int64_t max_size;
+} FrameStack;
+
+FrameStack* new_frame_stack();
+
+void delete_frame_stack(FrameStack* stack);
+
+bool advance_frame_segment(FrameStack* stack);
+
+static inline bool push_frame(FrameStack* stack, int32_t m, int32_t n) {
+    if (stack == NULL || stack->size >= stack->max_size) {
+        return false;
+    }
+    
+    if (stack->top == stack->current->capacity && !advance_frame_segment(stack)) {
+        return false;
+    }
+    
+    AckermannFrame* frame = &stack->current->frames[stack->top];
+    frame->m = m;
+    frame->n = n;
+    ++stack->top;
+    ++stack->size;
+    return true;
+}
+
+static inline bool pop_frame(FrameStack* stack, AckermannFrame* frame) {
+    if (stack == NULL || stack->size == 0) {
+        return false;
+    }
+    
+    if (stack->top == 0) {
+        stack->current = stack->current->prev;
+        stack->top = stack->current->capacity;
+    }
+    
+    --stack->top;
+    --stack->size;
+    *frame = stack->current->frames[stack->top];
+    return true;
+}
+
+static inline AckermannFrame* top_frame(FrameStack* stack) {
+    if (stack == NULL || stack->size == 0) {
+        return NULL;
+    }
+    
+    if (stack->top == 0) {
+        FrameSegment* prev = stack->current->prev;
+        return &prev->frames[prev->capacity - 1];
+    }
+    
+    return &stack->current->frames[stack->top - 1];
+}
+
+int64_t frame_stack_size(FrameStack* stack);
+
+bool is_frame_stack_empty(FrameStack* stack);
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef WRITER_H
+#define WRITER_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define OUTPUT_BUFFER_SIZE (1 << 16)
+#define MAX_INT32_CHARS 11
+#define MAX_INT64_CHARS 20
+
+typedef struct {
+    FILE* file;
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    int64_t written;
+    bool failed;
+} OutputWriter;
+
+OutputWriter* new_output_writer(FILE* file, size_t capacity = OUTPUT_BUFFER_SIZE);
+
+bool delete_output_writer(OutputWriter* writer);
+
+bool flush_output(OutputWriter* writer);
+
+void write_bytes(OutputWriter* writer, const char* data, size_t length);
+
+void write_string(OutputWriter* writer, const char* text);
+
+void write_char(OutputWriter* writer, char c);
+
+void write_int32(OutputWriter* writer, int32_t value);
+
+void write_int64(OutputWriter* writer, int64_t value);
+
+void write_int32_padded(OutputWriter* writer, int32_t value, int32_t width);
+
+#endif
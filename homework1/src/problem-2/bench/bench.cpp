@@ -0,0 +1,128 @@
+#include "../lib/powerset.h"
+#include "../lib/benchmark.h"
+
+typedef struct {
+    int32_t* set;
+    int32_t set_size;
+    PowerSetStorage storage;
+    int32_t thread_count;
+    PowerSetMatrix* result;
+    int64_t streamed;
+} PowerSetCase;
+
+static void run_recursive(void* context) {
+    PowerSetCase* c = (PowerSetCase*)context;
+    c->result = powerset_matrix_recursive(c->set, c->set_size, c->storage);
+}
+
+static void run_block_doubling(void* context) {
+    PowerSetCase* c = (PowerSetCase*)context;
+    c->result = powerset_matrix_block_doubling(c->set, c->set_size, c->storage);
+}
+
+static void run_iterative(void* context) {
+    PowerSetCase* c = (PowerSetCase*)context;
+    c->result = powerset_matrix_iterative(c->set, c->set_size, c->storage);
+}
+
+static void run_parallel(void* context) {
+    PowerSetCase* c = (PowerSetCase*)context;
+    c->result = powerset_matrix_iterative_parallel(c->set, c->set_size, c->thread_count, c->storage);
+}
+
+static bool count_visitor(const int32_t* subset, int32_t size, void* context) {
+    (void)subset;
+    *(int64_t*)context += size;
+    return true;
+}
+
+static void run_gray_stream(void* context) {
+    PowerSetCase* c = (PowerSetCase*)context;
+    int64_t elements = 0;
+    c->streamed = visit_powerset_gray(c->set, c->set_size, count_visitor, &elements);
+}
+
+static void release_result(void* context) {
+    PowerSetCase* c = (PowerSetCase*)context;
+    delete_powerset_matrix(c->result);
+    c->result = NULL;
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config = default_bench_config();
+    if (!parse_bench_args(argc, argv, &config)) {
+        return 1;
+    }
+    
+    const int32_t sweep[] = {10, 14, 18, 20};
+    const int32_t sweep_size = sizeof(sweep) / sizeof(sweep[0]);
+    const PowerSetStorage storages[] = {POWERSET_MATRIX, POWERSET_MASK, POWERSET_CSR};
+    const int32_t thread_sweep[] = {1, 2, 4, 8};
+    const int32_t thread_sweep_size = sizeof(thread_sweep) / sizeof(thread_sweep[0]);
+    const int32_t parallel_sweep[] = {22};
+    const int32_t parallel_sweep_size = sizeof(parallel_sweep) / sizeof(parallel_sweep[0]);
+    
+    int32_t set[MAX_MASK_ELEMENTS];
+    for (int32_t i = 0; i < MAX_MASK_ELEMENTS; ++i) {
+        set[i] = i + 1;
+    }
+    
+    BenchReport* report = new_bench_report();
+    if (report == NULL) {
+        return 1;
+    }
+    
+    PowerSetCase c;
+    c.set = set;
+    c.result = NULL;
+    c.thread_count = 1;
+    
+    for (int32_t i = 0; i < sweep_size; ++i) {
+        c.set_size = sweep[i];
+        
+        for (int32_t s = 0; s < 3; ++s) {
+            char name[BENCH_NAME_LENGTH];
+            char params[BENCH_NAME_LENGTH];
+            c.storage = storages[s];
+            snprintf(params, sizeof(params), "n=%d storage=%s", c.set_size, powerset_storage_name(c.storage));
+            
+            snprintf(name, sizeof(name), "powerset_recursive");
+            add_bench_result(report, run_benchmark(name, params, NULL, run_recursive, release_result, &c, config));
+            snprintf(name, sizeof(name), "powerset_block_doubling");
+            add_bench_result(report, run_benchmark(name, params, NULL, run_block_doubling, release_result, &c, config));
+            snprintf(name, sizeof(name), "powerset_iterative");
+            add_bench_result(report, run_benchmark(name, params, NULL, run_iterative, release_result, &c, config));
+            
+            for (int32_t t = 0; t < thread_sweep_size; ++t) {
+                c.thread_count = thread_sweep[t];
+                snprintf(name, sizeof(name), "powerset_parallel_t%d", c.thread_count);
+                add_bench_result(report, run_benchmark(name, params, NULL, run_parallel, release_result, &c, config));
+            }
+        }
+        
+        char params[BENCH_NAME_LENGTH];
+        snprintf(params, sizeof(params), "n=%d", c.set_size);
+        add_bench_result(report, run_benchmark("powerset_gray_stream", params, NULL, run_gray_stream, NULL, &c, config));
+    }
+    
+    for (int32_t i = 0; i < parallel_sweep_size; ++i) {
+        c.set_size = parallel_sweep[i];
+        
+        for (int32_t s = 0; s < 3; ++s) {
+            char name[BENCH_NAME_LENGTH];
+            char params[BENCH_NAME_LENGTH];
+            c.storage = storages[s];
+            snprintf(params, sizeof(params), "n=%d storage=%s", c.set_size, powerset_storage_name(c.storage));
+            
+            for (int32_t t = 0; t < thread_sweep_size; ++t) {
+                c.thread_count = thread_sweep[t];
+                snprintf(name, sizeof(name), "powerset_parallel_t%d", c.thread_count);
+                add_bench_result(report, run_benchmark(name, params, NULL, run_parallel, release_result, &c, config));
+            }
+        }
+    }
+    
+    bool written = write_bench_report(report, config);
+    delete_bench_report(report);
+    return written ? 0 : 1;
+}
@@ -0,0 +1,217 @@
+#include "../lib/array.h"
+#include "../lib/gap_array.h"
+#include "../lib/benchmark.h"
+
+typedef struct {
+    int32_t initial_size;
+    int32_t operations;
+    ArrayList* array_list;
+    GapArrayList* gap_list;
+    int64_t sink;
+} ListCase;
+
+static uint32_t next_random(uint32_t* state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+template <typename List>
+static void fill_list(List* list, int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        add(list, i);
+    }
+}
+
+template <typename List>
+static int64_t front_edits(List* list, int32_t operations) {
+    for (int32_t i = 0; i < operations; ++i) {
+        insert_item(list, 0, i);
+        insert_item(list, 1, i);
+        remove_item(list, 0);
+    }
+    return size(list);
+}
+
+template <typename List>
+static int64_t cursor_edits(List* list, int32_t operations) {
+    uint32_t state = 7;
+    int64_t cursor = size(list) / 2;
+    for (int32_t i = 0; i < operations; ++i) {
+        cursor += (int32_t)(next_random(&state) % 17) - 8;
+        if (cursor < 0) cursor = 0;
+        if (cursor >= size(list)) cursor = size(list) - 1;
+        
+        if (i % 3 == 2) {
+            remove_item(list, cursor);
+        } else {
+            insert_item(list, cursor, i);
+        }
+    }
+    return size(list);
+}
+
+template <typename List>
+static int64_t random_edits(List* list, int32_t operations) {
+    uint32_t state = 11;
+    for (int32_t i = 0; i < operations; ++i) {
+        int64_t index = (int64_t)(next_random(&state) % (uint64_t)size(list));
+        if (i % 2 == 1) {
+            remove_item(list, index);
+        } else {
+            insert_item(list, index, i);
+        }
+    }
+    return size(list);
+}
+
+template <typename List>
+static int64_t indexed_reads(List* list, int32_t operations) {
+    int64_t total = 0;
+    int64_t count = size(list);
+    for (int32_t i = 0; i < operations; ++i) {
+        total += get(list, ((int64_t)i * 7919) % count);
+    }
+    return total + find(list, -1);
+}
+
+static void setup_array(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->array_list = new_list();
+    fill_list(c->array_list, c->initial_size);
+}
+
+static void setup_gap(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->gap_list = new_gap_list();
+    fill_list(c->gap_list, c->initial_size);
+    insert_item(c->gap_list, c->initial_size / 2, -2);
+    remove_item(c->gap_list, c->initial_size / 2);
+}
+
+static void teardown_array(void* context) {
+    ListCase* c = (ListCase*)context;
+    delete_list(c->array_list);
+    c->array_list = NULL;
+}
+
+static void teardown_gap(void* context) {
+    ListCase* c = (ListCase*)context;
+    delete_list(c->gap_list);
+    c->gap_list = NULL;
+}
+
+static void array_front(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->sink += front_edits(c->array_list, c->operations);
+}
+
+static void gap_front(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->sink += front_edits(c->gap_list, c->operations);
+}
+
+static void array_cursor(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->sink += cursor_edits(c->array_list, c->operations);
+}
+
+static void gap_cursor(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->sink += cursor_edits(c->gap_list, c->operations);
+}
+
+static void array_random(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->sink += random_edits(c->array_list, c->operations);
+}
+
+static void gap_random(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->sink += random_edits(c->gap_list, c->operations);
+}
+
+static void array_reads(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->sink += indexed_reads(c->array_list, c->operations);
+}
+
+static void gap_reads(void* context) {
+    ListCase* c = (ListCase*)context;
+    c->sink += indexed_reads(c->gap_list, c->operations);
+}
+
+static bool check_arena_accounting() {
+    reset_alloc_stats();
+    
+    Arena* arena = new_arena(256);
+    ArrayList* list = new_list_in(arena);
+    if (arena == NULL || list == NULL) {
+        delete_arena(arena);
+        return false;
+    }
+    
+    fill_list(list, 4096);
+    delete_list(list);
+    delete_arena(arena);
+    
+    AllocStats stats = get_alloc_stats();
+    if (stats.allocations != stats.frees || stats.live_bytes != stats.baseline_bytes) {
+        fprintf(stderr, "Arena accounting mismatch: %lld allocs, %lld frees, %lld live bytes after delete_arena\n",
+                (long long)stats.allocations, (long long)stats.frees,
+                (long long)(stats.live_bytes - stats.baseline_bytes));
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config = default_bench_config();
+    if (!parse_bench_args(argc, argv, &config)) {
+        return 1;
+    }
+    
+    if (!check_arena_accounting()) {
+        return 1;
+    }
+    
+    const int32_t sizes[] = {1 << 12, 1 << 16, 1 << 20};
+    const char* workloads[] = {"front_edits", "cursor_edits", "random_edits", "indexed_reads"};
+    BenchFunction array_runs[] = {array_front, array_cursor, array_random, array_reads};
+    BenchFunction gap_runs[] = {gap_front, gap_cursor, gap_random, gap_reads};
+    const int32_t workload_count = sizeof(array_runs) / sizeof(array_runs[0]);
+    
+    BenchReport* report = new_bench_report();
+    if (report == NULL) {
+        return 1;
+    }
+    
+    ListCase c;
+    c.operations = 20000;
+    c.array_list = NULL;
+    c.gap_list = NULL;
+    c.sink = 0;
+    
+    for (int32_t s = 0; s < 3; ++s) {
+        c.initial_size = sizes[s];
+        
+        for (int32_t w = 0; w < workload_count; ++w) {
+            char params[BENCH_NAME_LENGTH];
+            
+            snprintf(params, sizeof(params), "n=%d ops=%d list=array", c.initial_size, c.operations);
+            BenchResult array_result = run_benchmark(workloads[w], params, setup_array, array_runs[w], teardown_array, &c, config);
+            add_bench_result(report, array_result);
+            
+            snprintf(params, sizeof(params), "n=%d ops=%d list=gap", c.initial_size, c.operations);
+            BenchResult gap_result = run_benchmark(workloads[w], params, setup_gap, gap_runs[w], teardown_gap, &c, config);
+            add_bench_result(report, gap_result);
+            
+            if (gap_result.wall_median > 0) {
+                fprintf(stderr, "%s n=%d: gap %.2fx vs array\n", workloads[w], c.initial_size, array_result.wall_median / gap_result.wall_median);
+            }
+        }
+    }
+    
+    bool written = write_bench_report(report, config);
+    delete_bench_report(report);
+    return written ? 0 : 1;
+}
@@ -0,0 +1,132 @@
+#include "../lib/powerset.h"
+#include "../lib/writer.h"
+#include "../lib/benchmark.h"
+
+typedef struct {
+    PowerSetMatrix* powerset;
+    MatrixList* matrix;
+    FILE* sink;
+    int64_t bytes;
+} OutputCase;
+
+static void fprintf_powerset(PowerSetMatrix* ps, FILE* out) {
+    fprintf(out, "PowerSet with %lld subsets:\n", (long long)ps->subset_count);
+    fprintf(out, "{ ");
+    
+    for (int64_t i = 0; i < ps->subset_count; ++i) {
+        fprintf(out, "{");
+        
+        int32_t size = get_subset_size(ps, i);
+        for (int32_t j = 0; j < size; ++j) {
+            fprintf(out, "%d", get_subset_element(ps, i, j));
+            if (j < size - 1) fprintf(out, ",");
+        }
+        
+        fprintf(out, "}");
+        if (i < ps->subset_count - 1) fprintf(out, ", ");
+    }
+    
+    fprintf(out, " }\n");
+}
+
+static void fprintf_matrix(MatrixList* matrix, FILE* out) {
+    for (int32_t i = 0; i < matrix->rows; i++) {
+        fprintf(out, "  [");
+        for (int32_t j = 0; j < matrix->cols; j++) {
+            fprintf(out, "%4d", get_matrix(matrix, i, j));
+            if (j < matrix->cols - 1) fprintf(out, ", ");
+        }
+        fprintf(out, "]\n");
+    }
+}
+
+static void run_powerset_fprintf(void* context) {
+    OutputCase* c = (OutputCase*)context;
+    fprintf_powerset(c->powerset, c->sink);
+    fflush(c->sink);
+}
+
+static void run_powerset_writer(void* context) {
+    OutputCase* c = (OutputCase*)context;
+    OutputWriter* writer = new_output_writer(c->sink);
+    write_powerset_matrix(c->powerset, writer);
+    flush_output(writer);
+    c->bytes = writer->written;
+    delete_output_writer(writer);
+    fflush(c->sink);
+}
+
+static void run_matrix_fprintf(void* context) {
+    OutputCase* c = (OutputCase*)context;
+    fprintf_matrix(c->matrix, c->sink);
+    fflush(c->sink);
+}
+
+static void run_matrix_writer(void* context) {
+    OutputCase* c = (OutputCase*)context;
+    OutputWriter* writer = new_output_writer(c->sink);
+    write_matrix(c->matrix, writer);
+    flush_output(writer);
+    c->bytes = writer->written;
+    delete_output_writer(writer);
+    fflush(c->sink);
+}
+
+static void report_throughput(const char* name, int64_t bytes, BenchResult result) {
+    if (result.wall_median > 0) {
+        fprintf(stderr, "%s %s: %.1f MB/s\n", name, result.params, bytes / result.wall_median / 1e6);
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config = default_bench_config();
+    if (!parse_bench_args(argc, argv, &config)) {
+        return 1;
+    }
+    
+    int32_t set[20];
+    for (int32_t i = 0; i < 20; ++i) {
+        set[i] = i + 1;
+    }
+    
+    OutputCase c;
+    c.powerset = powerset_matrix_iterative(set, 20, POWERSET_CSR);
+    c.matrix = new_matrix(1000, 1000);
+    c.sink = fopen("/dev/null", "w");
+    c.bytes = 0;
+    
+    BenchReport* report = new_bench_report();
+    if (c.powerset == NULL || c.matrix == NULL || c.sink == NULL || report == NULL) {
+        return 1;
+    }
+    
+    for (int32_t i = 0; i < 1000; ++i) {
+        for (int32_t j = 0; j < 1000; ++j) {
+            set_matrix(c.matrix, i, j, (i * 7 + j * 13) % 2000 - 1000);
+        }
+    }
+    
+    BenchResult writer_result = run_benchmark("print_powerset_writer", "n=20 storage=csr", NULL, run_powerset_writer, NULL, &c, config);
+    int64_t powerset_bytes = c.bytes;
+    BenchResult fprintf_result = run_benchmark("print_powerset_fprintf", "n=20 storage=csr", NULL, run_powerset_fprintf, NULL, &c, config);
+    add_bench_result(report, fprintf_result);
+    add_bench_result(report, writer_result);
+    report_throughput("print_powerset_fprintf", powerset_bytes, fprintf_result);
+    report_throughput("print_powerset_writer", powerset_bytes, writer_result);
+    
+    writer_result = run_benchmark("print_matrix_writer", "1000x1000", NULL, run_matrix_writer, NULL, &c, config);
+    int64_t matrix_bytes = c.bytes;
+    fprintf_result = run_benchmark("print_matrix_fprintf", "1000x1000", NULL, run_matrix_fprintf, NULL, &c, config);
+    add_bench_result(report, fprintf_result);
+    add_bench_result(report, writer_result);
+    report_throughput("print_matrix_fprintf", matrix_bytes, fprintf_result);
+    report_throughput("print_matrix_writer", matrix_bytes, writer_result);
+    
+    bool written = write_bench_report(report, config);
+    
+    fclose(c.sink);
+    delete_powerset_matrix(c.powerset);
+    delete_matrix(c.matrix);
+    delete_bench_report(report);
+    return written ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+#include "../lib/simd.h"
+#include "../lib/matrix.h"
+#include "../lib/benchmark.h"
+
+typedef struct {
+    int32_t* data;
+    int64_t count;
+    MatrixList* matrix;
+    int64_t sink;
+} SimdCase;
+
+static void run_find(void* context) {
+    SimdCase* c = (SimdCase*)context;
+    c->sink += simd_find_i32(c->data, c->count, -7);
+}
+
+static void run_count(void* context) {
+    SimdCase* c = (SimdCase*)context;
+    c->sink += simd_count_i32(c->data, c->count, 3);
+}
+
+static void run_fill(void* context) {
+    SimdCase* c = (SimdCase*)context;
+    simd_fill_i32(c->data, c->count, (int32_t)c->sink);
+}
+
+static void run_min(void* context) {
+    SimdCase* c = (SimdCase*)context;
+    c->sink += simd_min_i32(c->data, c->count);
+}
+
+static void run_max(void* context) {
+    SimdCase* c = (SimdCase*)context;
+    c->sink += simd_max_i32(c->data, c->count);
+}
+
+static void run_sum(void* context) {
+    SimdCase* c = (SimdCase*)context;
+    c->sink += simd_sum_i32(c->data, c->count);
+}
+
+static void run_fill_matrix(void* context) {
+    SimdCase* c = (SimdCase*)context;
+    fill_matrix(c->matrix, -1);
+}
+
+static void refill(void* context) {
+    SimdCase* c = (SimdCase*)context;
+    for (int64_t i = 0; i < c->count; ++i) {
+        c->data[i] = (int32_t)(i % 1000);
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config = default_bench_config();
+    if (!parse_bench_args(argc, argv, &config)) {
+        return 1;
+    }
+    
+    const int64_t sizes[] = {(int64_t)1 << 16, (int64_t)1 << 24};
+    const char* names[] = {"simd_find", "simd_count", "simd_fill", "simd_min", "simd_max", "simd_sum", "fill_matrix"};
+    BenchFunction kernels[] = {run_find, run_count, run_fill, run_min, run_max, run_sum, run_fill_matrix};
+    const int32_t kernel_count = sizeof(kernels) / sizeof(kernels[0]);
+    SimdBackend best = simd_detect_backend();
+    
+    BenchReport* report = new_bench_report();
+    SimdCase c;
+    c.sink = 0;
+    
+    for (int32_t s = 0; s < 2; ++s) {
+        c.count = sizes[s];
+        c.data = (int32_t*)malloc(sizeof(int32_t) * c.count);
+        c.matrix = new_matrix((int32_t)(c.count / 20), 20);
+        if (report == NULL || c.data == NULL || c.matrix == NULL) {
+            return 1;
+        }
+        
+        for (int32_t k = 0; k < kernel_count; ++k) {
+            double scalar_median = 0;
+            
+            for (int32_t b = SIMD_SCALAR; b <= best; ++b) {
+                simd_set_backend((SimdBackend)b);
+                
+                char params[BENCH_NAME_LENGTH];
+                snprintf(params, sizeof(params), "n=%lld backend=%s", (long long)c.count, simd_backend_name((SimdBackend)b));
+                
+                BenchResult result = run_benchmark(names[k], params, refill, kernels[k], NULL, &c, config);
+                add_bench_result(report, result);
+                
+                if (b == SIMD_SCALAR) {
+                    scalar_median = result.wall_median;
+                } else if (result.wall_median > 0) {
+                    fprintf(stderr, "%s %s: %.2fx vs scalar\n", names[k], params, scalar_median / result.wall_median);
+                }
+            }
+        }
+        
+        free(c.data);
+        delete_matrix(c.matrix);
+    }
+    
+    simd_set_backend(best);
+    bool written = write_bench_report(report, config);
+    delete_bench_report(report);
+    return written ? 0 : 1;
+}
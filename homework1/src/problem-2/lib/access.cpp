@@ -0,0 +1,21 @@
+#include "./access.h"
+
+const char* ds_status_name(DsStatus status) {
+    switch (status) {
+        case DS_OK:
+            return "ok";
+        case DS_NULL_POINTER:
+            return "null pointer";
+        case DS_OUT_OF_RANGE:
+            return "out of range";
+        case DS_READ_ONLY:
+            return "read only";
+        default:
+            return "unknown";
+    }
+}
+
+void ds_access_failure(const char* condition, const char* file, int32_t line) {
+    fprintf(stderr, "%s:%d: checked access failed: %s\n", file, line, condition);
+    abort();
+}
@@ -0,0 +1,28 @@
+#ifndef ACCESS_H
+#define ACCESS_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+typedef enum {
+    DS_OK,
+    DS_NULL_POINTER,
+    DS_OUT_OF_RANGE,
+    DS_READ_ONLY
+} DsStatus;
+
+const char* ds_status_name(DsStatus status);
+
+void ds_access_failure(const char* condition, const char* file, int32_t line);
+
+#ifdef DS_CHECKED_ACCESS
+#define DS_CHECK_ACCESS(condition) \
+    ((condition) ? (void)0 : ds_access_failure(#condition, __FILE__, __LINE__))
+#else
+#define DS_CHECK_ACCESS(condition) ((void)0)
+#endif
+
+#endif
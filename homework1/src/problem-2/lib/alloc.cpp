@@ -0,0 +1,164 @@
+#include "./alloc.h"
+
+#ifdef DS_ALLOC_STATS
+#include <malloc.h>
+#include <atomic>
+
+static std::atomic<int64_t> allocations(0);
+static std::atomic<int64_t> frees(0);
+static std::atomic<int64_t> reallocations(0);
+static std::atomic<int64_t> bytes_allocated(0);
+static std::atomic<int64_t> bytes_reallocated(0);
+static std::atomic<int64_t> bytes_copied(0);
+static std::atomic<int64_t> live_bytes(0);
+static std::atomic<int64_t> peak_bytes(0);
+static std::atomic<int64_t> baseline_bytes(0);
+
+static void add_live_bytes(int64_t delta) {
+    int64_t live = live_bytes.fetch_add(delta, std::memory_order_relaxed) + delta;
+    int64_t peak = peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+static void record_allocation(void* pointer) {
+    if (pointer == NULL) {
+        return;
+    }
+    
+    int64_t bytes = (int64_t)malloc_usable_size(pointer);
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+    add_live_bytes(bytes);
+}
+
+void* tracked_malloc(size_t bytes) {
+    void* pointer = malloc(bytes);
+    record_allocation(pointer);
+    return pointer;
+}
+
+void* tracked_calloc(size_t count, size_t size) {
+    void* pointer = calloc(count, size);
+    record_allocation(pointer);
+    return pointer;
+}
+
+void* tracked_aligned_alloc(size_t alignment, size_t bytes) {
+    void* pointer = aligned_alloc(alignment, bytes);
+    record_allocation(pointer);
+    return pointer;
+}
+
+void* tracked_realloc(void* pointer, size_t bytes) {
+    if (pointer == NULL) {
+        return tracked_malloc(bytes);
+    }
+    
+    int64_t old_bytes = (int64_t)malloc_usable_size(pointer);
+    void* extend = realloc(pointer, bytes);
+    if (extend == NULL) {
+        return NULL;
+    }
+    
+    int64_t new_bytes = (int64_t)malloc_usable_size(extend);
+    reallocations.fetch_add(1, std::memory_order_relaxed);
+    bytes_reallocated.fetch_add(old_bytes, std::memory_order_relaxed);
+    if (new_bytes > old_bytes) {
+        bytes_allocated.fetch_add(new_bytes - old_bytes, std::memory_order_relaxed);
+    }
+    add_live_bytes(new_bytes - old_bytes);
+    return extend;
+}
+
+void tracked_free(void* pointer) {
+    if (pointer == NULL) {
+        return;
+    }
+    
+    frees.fetch_add(1, std::memory_order_relaxed);
+    add_live_bytes(-(int64_t)malloc_usable_size(pointer));
+    free(pointer);
+}
+
+void record_copied_bytes(int64_t bytes) {
+    bytes_copied.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void reset_alloc_stats() {
+    int64_t live = live_bytes.load(std::memory_order_relaxed);
+    allocations.store(0, std::memory_order_relaxed);
+    frees.store(0, std::memory_order_relaxed);
+    reallocations.store(0, std::memory_order_relaxed);
+    bytes_allocated.store(0, std::memory_order_relaxed);
+    bytes_reallocated.store(0, std::memory_order_relaxed);
+    bytes_copied.store(0, std::memory_order_relaxed);
+    peak_bytes.store(live, std::memory_order_relaxed);
+    baseline_bytes.store(live, std::memory_order_relaxed);
+}
+
+AllocStats get_alloc_stats() {
+    AllocStats stats;
+    stats.allocations = allocations.load(std::memory_order_relaxed);
+    stats.frees = frees.load(std::memory_order_relaxed);
+    stats.reallocations = reallocations.load(std::memory_order_relaxed);
+    stats.bytes_allocated = bytes_allocated.load(std::memory_order_relaxed);
+    stats.bytes_reallocated = bytes_reallocated.load(std::memory_order_relaxed);
+    stats.bytes_copied = bytes_copied.load(std::memory_order_relaxed);
+    stats.live_bytes = live_bytes.load(std::memory_order_relaxed);
+    stats.peak_bytes = peak_bytes.load(std::memory_order_relaxed);
+    stats.baseline_bytes = baseline_bytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void print_alloc_stats(const AllocStats* stats) {
+    if (stats == NULL) {
+        return;
+    }
+    
+    printf("Allocations: %lld allocs, %lld frees, %lld reallocs, %lld bytes allocated, "
+           "%lld bytes reallocated, %lld bytes copied, peak %lld bytes (+%lld over start)\n",
+           (long long)stats->allocations, (long long)stats->frees, (long long)stats->reallocations,
+           (long long)stats->bytes_allocated, (long long)stats->bytes_reallocated, (long long)stats->bytes_copied,
+           (long long)stats->peak_bytes, (long long)(stats->peak_bytes - stats->baseline_bytes));
+}
+#endif
+
+bool checked_mul_i64(int64_t a, int64_t b, int64_t* result) {
+    return !__builtin_mul_overflow(a, b, result);
+}
+
+bool checked_array_bytes(int64_t count, size_t element_size, size_t* bytes) {
+    if (count < 0) {
+        return false;
+    }
+    
+    return !__builtin_mul_overflow((size_t)count, element_size, bytes) && *bytes <= (size_t)PTRDIFF_MAX;
+}
+
+void* malloc_array(int64_t count, size_t element_size) {
+    size_t bytes = 0;
+    if (!checked_array_bytes(count, element_size, &bytes)) {
+        return NULL;
+    }
+    
+    return tracked_malloc(bytes > 0 ? bytes : 1);
+}
+
+void* calloc_array(int64_t count, size_t element_size) {
+    size_t bytes = 0;
+    if (!checked_array_bytes(count, element_size, &bytes)) {
+        return NULL;
+    }
+    
+    return tracked_calloc(count > 0 ? (size_t)count : 1, element_size > 0 ? element_size : 1);
+}
+
+void* realloc_array(void* pointer, int64_t count, size_t element_size) {
+    size_t bytes = 0;
+    if (!checked_array_bytes(count, element_size, &bytes)) {
+        return NULL;
+    }
+    
+    return tracked_realloc(pointer, bytes > 0 ? bytes : 1);
+}
@@ -0,0 +1,91 @@
+#include "./arena.h"
+
+static ArenaBlock* new_arena_block(size_t capacity) {
+    ArenaBlock* block = (ArenaBlock*)tracked_malloc(sizeof(ArenaBlock));
+    if (block == NULL) {
+        return NULL;
+    }
+    
+    block->data = (unsigned char*)tracked_aligned_alloc(ARENA_ALIGNMENT, capacity);
+    if (block->data == NULL) {
+        tracked_free(block);
+        return NULL;
+    }
+    
+    block->next = NULL;
+    block->capacity = capacity;
+    return block;
+}
+
+static size_t align_size(size_t bytes) {
+    return (bytes + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+Arena* new_arena(size_t block_size) {
+    Arena* arena = (Arena*)tracked_malloc(sizeof(Arena));
+    if (arena == NULL) {
+        return NULL;
+    }
+    
+    arena->block_size = align_size(block_size > 0 ? block_size : ARENA_ALIGNMENT);
+    arena->head = new_arena_block(arena->block_size);
+    if (arena->head == NULL) {
+        tracked_free(arena);
+        return NULL;
+    }
+    
+    arena->current = arena->head;
+    arena->offset = 0;
+    return arena;
+}
+
+void delete_arena(Arena* arena) {
+    if (arena == NULL) {
+        return;
+    }
+    
+    ArenaBlock* block = arena->head;
+    while (block != NULL) {
+        ArenaBlock* next = block->next;
+        tracked_free(block->data);
+        tracked_free(block);
+        block = next;
+    }
+    
+    tracked_free(arena);
+}
+
+void* arena_alloc(Arena* arena, size_t bytes) {
+    if (arena == NULL) {
+        return NULL;
+    }
+    
+    bytes = align_size(bytes > 0 ? bytes : 1);
+    
+    if (arena->offset + bytes > arena->current->capacity) {
+        ArenaBlock* next = arena->current->next;
+        
+        if (next == NULL || next->capacity < bytes) {
+            next = new_arena_block(bytes > arena->block_size ? bytes : arena->block_size);
+            if (next == NULL) {
+                return NULL;
+            }
+            next->next = arena->current->next;
+            arena->current->next = next;
+        }
+        
+        arena->current = next;
+        arena->offset = 0;
+    }
+    
+    void* memory = arena->current->data + arena->offset;
+    arena->offset += bytes;
+    return memory;
+}
+
+void reset_arena(Arena* arena) {
+    if (arena != NULL) {
+        arena->current = arena->head;
+        arena->offset = 0;
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "./alloc.h"
+
+#define ARENA_ALIGNMENT 16
+
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t capacity;
+    unsigned char* data;
+} ArenaBlock;
+
+typedef struct {
+    ArenaBlock* head;
+    ArenaBlock* current;
+    size_t offset;
+    size_t block_size;
+} Arena;
+
+Arena* new_arena(size_t block_size);
+
+void delete_arena(Arena* arena);
+
+void* arena_alloc(Arena* arena, size_t bytes);
+
+void reset_arena(Arena* arena);
+
+#endif
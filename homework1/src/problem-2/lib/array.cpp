@@ -1,25 +1,34 @@
 #include "./array.h"
 
 ArrayList* new_list() {
-    ArrayList* nums = (ArrayList*)malloc(sizeof(ArrayList));
-    if (nums == NULL) {
+    void* memory = tracked_malloc(sizeof(ArrayList));
+    if (memory == NULL) {
         return NULL;
     }
-    nums->capacity = 10;
-    nums->arr = (int32_t*)malloc(sizeof(int32_t) * nums->capacity);
-    if (nums->arr == NULL) {
-        free(nums);
+    return new (memory) ArrayList();
+}
+
+ArrayList* new_list_in(Arena* arena) {
+    if (arena == NULL) {
+        return new_list();
+    }
+    
+    void* memory = arena_alloc(arena, sizeof(ArrayList));
+    if (memory == NULL) {
         return NULL;
     }
-    nums->size = 0;
-    nums->extend_ratio = 2;
-    return nums;
+    return new (memory) ArrayList(arena);
 }
 
 void delete_list(ArrayList* list) {
-    if (list != NULL) {
-        free(list->arr);
-        free(list);
+    if (list == NULL) {
+        return;
+    }
+    
+    Arena* arena = list->arena();
+    list->~ArrayList();
+    if (arena == NULL) {
+        tracked_free(list);
     }
 }
 
@@ -28,116 +37,125 @@ void extend_capacity(ArrayList* list) {
         return;
     }
     
-    int32_t new_capacity = capacity(list) * list->extend_ratio;
-    int32_t* extend = (int32_t*)malloc(sizeof(int32_t) * new_capacity);
-    
-    if (extend == NULL) {
-        return;
-    }
-    
-    memcpy(extend, list->arr, sizeof(int32_t) * size(list));
-    
-    free(list->arr);
-    list->arr = extend;
-    list->capacity = new_capacity;
+    list->reserve(capacity(list) * 2);
 }
 
-int32_t size(ArrayList* list) {
+int64_t size(ArrayList* list) {
     if (list == NULL) return 0;
-    return list->size;
+    return list->size();
 }
 
-int32_t capacity(ArrayList* list) {
+int64_t capacity(ArrayList* list) {
     if (list == NULL) return 0;
-    return list->capacity;
+    return list->capacity();
 }
 
-int32_t get(ArrayList* list, int32_t index) {
-    if (list == NULL || index < 0 || index >= size(list)) {
-        return -1;
+int32_t get(ArrayList* list, int64_t index) {
+    int32_t value = -1;
+    try_get(list, index, &value);
+    return value;
+}
+
+void set(ArrayList* list, int64_t index, int32_t num) {
+    try_set(list, index, num);
+}
+
+DsStatus try_get(ArrayList* list, int64_t index, int32_t* value) {
+    if (list == NULL || value == NULL) {
+        return DS_NULL_POINTER;
+    }
+    if (index < 0 || index >= size(list)) {
+        return DS_OUT_OF_RANGE;
     }
-    return list->arr[index];
+    
+    *value = (*list)[index];
+    return DS_OK;
 }
 
-void set(ArrayList* list, int32_t index, int32_t num) {
-    if (list == NULL || index < 0 || index >= size(list)) {
-        return;
+DsStatus try_set(ArrayList* list, int64_t index, int32_t num) {
+    if (list == NULL) {
+        return DS_NULL_POINTER;
     }
-    list->arr[index] = num;
+    if (index < 0 || index >= size(list)) {
+        return DS_OUT_OF_RANGE;
+    }
+    
+    (*list)[index] = num;
+    return DS_OK;
 }
 
 void add(ArrayList* list, int32_t num) {
     if (list == NULL) return;
     
-    if (size(list) == capacity(list)) {
-        extend_capacity(list);
-    }
-    list->arr[size(list)] = num;
-    ++list->size;
+    list->add(num);
 }
 
-void insert_item(ArrayList* list, int32_t index, int32_t num) {
-    if (list == NULL || index < 0 || index > size(list)) {
-        return;
-    }
-    
-    if (size(list) == capacity(list)) {
-        extend_capacity(list);
-    }
-    
-    for (int32_t i = size(list); i > index; --i) {
-        list->arr[i] = list->arr[i - 1];
-    }
+void insert_item(ArrayList* list, int64_t index, int32_t num) {
+    if (list == NULL) return;
     
-    list->arr[index] = num;
-    ++list->size;
+    list->insert_item(index, num);
 }
 
-int32_t remove_item(ArrayList* list, int32_t index) {
-    if (list == NULL || index < 0 || index >= size(list)) {
+int32_t remove_item(ArrayList* list, int64_t index) {
+    int32_t num = -1;
+    if (list == NULL || !list->remove_item(index, &num)) {
         return -1;
     }
-    
-    int32_t num = list->arr[index];
-    
-    memmove(&list->arr[index], &list->arr[index + 1], 
-            sizeof(int32_t) * (size(list) - index - 1));
-    
-    --list->size;
     return num;
 }
 
 int32_t* to_array(ArrayList* list) {
-    if (list == NULL || list->size == 0) {
+    if (list == NULL || list->size() == 0) {
         return NULL;
     }
     
-    int32_t* array = (int32_t*)malloc(sizeof(int32_t) * list->size);
+    int32_t* array = (int32_t*)malloc_array(list->size(), sizeof(int32_t));
     if (array == NULL) {
         return NULL;
     }
     
-    memcpy(array, list->arr, sizeof(int32_t) * list->size);
+    memcpy(array, list->data(), sizeof(int32_t) * list->size());
     return array;
 }
 
 bool is_empty(ArrayList* list) {
-    return list == NULL || list->size == 0;
+    return list == NULL || list->empty();
 }
 
 void clear(ArrayList* list) {
     if (list != NULL) {
-        list->size = 0;
+        list->clear();
     }
 }
 
-int32_t find(ArrayList* list, int32_t value) {
+int64_t find(ArrayList* list, int32_t value) {
     if (list == NULL) return -1;
     
-    for (int32_t i = 0; i < size(list); ++i) {
-        if (list->arr[i] == value) {
-            return i;
-        }
-    }
-    return -1;
-}
\ No newline at end of file
+    return simd_find_i32(list->data(), size(list), value);
+}
+
+int64_t count_value(ArrayList* list, int32_t value) {
+    if (list == NULL) return 0;
+    
+    return simd_count_i32(list->data(), size(list), value);
+}
+
+bool min_value(ArrayList* list, int32_t* value) {
+    if (is_empty(list)) return false;
+    
+    *value = simd_min_i32(list->data(), size(list));
+    return true;
+}
+
+bool max_value(ArrayList* list, int32_t* value) {
+    if (is_empty(list)) return false;
+    
+    *value = simd_max_i32(list->data(), size(list));
+    return true;
+}
+
+int64_t sum_values(ArrayList* list) {
+    if (list == NULL) return 0;
+    
+    return simd_sum_i32(list->data(), size(list));
+}
@@ -6,33 +6,39 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include "./arena.h"
+#include "./containers.h"
+#include "./simd.h"
 
-typedef struct {
-    int32_t *arr;
-    int32_t capacity;
-    int32_t size;
-    int32_t extend_ratio;
-} ArrayList;
+#define ARRAY_INLINE_CAPACITY 10
+
+typedef ds::ArrayList<int32_t, ARRAY_INLINE_CAPACITY> ArrayList;
 
 ArrayList* new_list();
 
+ArrayList* new_list_in(Arena* arena);
+
 void delete_list(ArrayList* list);
 
 void extend_capacity(ArrayList* list);
 
-int32_t size(ArrayList* list);
+int64_t size(ArrayList* list);
+
+int64_t capacity(ArrayList* list);
 
-int32_t capacity(ArrayList* list);
+int32_t get(ArrayList* list, int64_t index);
 
-int32_t get(ArrayList* list, int32_t index);
+void set(ArrayList* list, int64_t index, int32_t num);
 
-void set(ArrayList* list, int32_t index, int32_t num);
+DsStatus try_get(ArrayList* list, int64_t index, int32_t* value);
+
+DsStatus try_set(ArrayList* list, int64_t index, int32_t num);
 
 void add(ArrayList* list, int32_t num);
 
-void insert_item(ArrayList* list, int32_t index, int32_t num);
+void insert_item(ArrayList* list, int64_t index, int32_t num);
 
-int32_t remove_item(ArrayList* list, int32_t index);
+int32_t remove_item(ArrayList* list, int64_t index);
 
 int32_t* to_array(ArrayList* list);
 
@@ -40,4 +46,14 @@ bool is_empty(ArrayList* list);
 
 void clear(ArrayList* list);
 
+int64_t find(ArrayList* list, int32_t value);
+
+int64_t count_value(ArrayList* list, int32_t value);
+
+bool min_value(ArrayList* list, int32_t* value);
+
+bool max_value(ArrayList* list, int32_t* value);
+
+int64_t sum_values(ArrayList* list);
+
 #endif 
\ No newline at end of file
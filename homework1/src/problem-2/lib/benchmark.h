@@ -0,0 +1,80 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define BENCH_NAME_LENGTH 64
+
+typedef enum {
+    BENCH_TEXT,
+    BENCH_JSON,
+    BENCH_CSV
+} BenchFormat;
+
+typedef struct {
+    int32_t warmup;
+    int32_t repetitions;
+    BenchFormat format;
+    const char* output_path;
+} BenchConfig;
+
+typedef struct {
+    double wall_start;
+    double cpu_start;
+    double wall;
+    double cpu;
+} BenchTimer;
+
+typedef struct {
+    char name[BENCH_NAME_LENGTH];
+    char params[BENCH_NAME_LENGTH];
+    int32_t repetitions;
+    double wall_median;
+    double wall_p95;
+    double wall_min;
+    double cpu_median;
+    double cpu_p95;
+    double cpu_min;
+} BenchResult;
+
+typedef struct {
+    BenchResult* results;
+    int32_t count;
+    int32_t capacity;
+} BenchReport;
+
+typedef void (*BenchFunction)(void* context);
+
+double wall_time_now();
+
+double cpu_time_now();
+
+void start_timer(BenchTimer* timer);
+
+void stop_timer(BenchTimer* timer);
+
+void sort_samples(double* samples, int32_t count);
+
+double sample_percentile(double* sorted, int32_t count, double ratio);
+
+BenchConfig default_bench_config();
+
+bool parse_bench_args(int argc, char** argv, BenchConfig* config);
+
+BenchResult run_benchmark(const char* name, const char* params, BenchFunction setup,
+                          BenchFunction function, BenchFunction teardown,
+                          void* context, BenchConfig config);
+
+BenchReport* new_bench_report();
+
+void delete_bench_report(BenchReport* report);
+
+void add_bench_result(BenchReport* report, BenchResult result);
+
+bool write_bench_report(BenchReport* report, BenchConfig config);
+
+#endif
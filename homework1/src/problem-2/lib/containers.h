@@ -0,0 +1,382 @@
+#ifndef CONTAINERS_H
+#define CONTAINERS_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "./arena.h"
+#include "./access.h"
+#include "./alloc.h"
+
+namespace ds {
+
+template <typename T, int32_t InlineN = 0>
+class ArrayList {
+public:
+    ArrayList() : data_(inline_data()), size_(0), capacity_(InlineN), arena_(NULL) {}
+    
+    explicit ArrayList(Arena* arena) : data_(inline_data()), size_(0), capacity_(InlineN), arena_(arena) {}
+    
+    ArrayList(const ArrayList&) = delete;
+    
+    ArrayList& operator=(const ArrayList&) = delete;
+    
+    ArrayList(ArrayList&& other) noexcept : data_(inline_data()), size_(0), capacity_(InlineN), arena_(NULL) {
+        take(other);
+    }
+    
+    ArrayList& operator=(ArrayList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            release();
+            data_ = inline_data();
+            capacity_ = InlineN;
+            take(other);
+        }
+        return *this;
+    }
+    
+    ~ArrayList() {
+        clear();
+        release();
+    }
+    
+    int64_t size() const { return size_; }
+    
+    int64_t capacity() const { return capacity_; }
+    
+    bool empty() const { return size_ == 0; }
+    
+    bool is_inline() const { return data_ == inline_data(); }
+    
+    Arena* arena() const { return arena_; }
+    
+    T* data() { return data_; }
+    
+    const T* data() const { return data_; }
+    
+    T* begin() { return data_; }
+    
+    T* end() { return data_ + size_; }
+    
+    const T* begin() const { return data_; }
+    
+    const T* end() const { return data_ + size_; }
+    
+    T& operator[](int64_t index) {
+        DS_CHECK_ACCESS(index >= 0 && index < size_);
+        return data_[index];
+    }
+    
+    const T& operator[](int64_t index) const {
+        DS_CHECK_ACCESS(index >= 0 && index < size_);
+        return data_[index];
+    }
+    
+    bool reserve(int64_t new_capacity) {
+        if (new_capacity <= capacity_) {
+            return true;
+        }
+        
+        T* extend = allocate(new_capacity);
+        if (extend == NULL) {
+            return false;
+        }
+        
+        record_copied_bytes((int64_t)sizeof(T) * size_);
+        relocate(data_, extend, size_);
+        release();
+        data_ = extend;
+        capacity_ = new_capacity;
+        return true;
+    }
+    
+    template <typename... Args>
+    T* emplace(Args&&... args) {
+        if (size_ == capacity_ && !reserve(grown_capacity())) {
+            return NULL;
+        }
+        
+        T* slot = new (&data_[size_]) T(std::forward<Args>(args)...);
+        ++size_;
+        return slot;
+    }
+    
+    bool add(const T& value) { return emplace(value) != NULL; }
+    
+    bool add(T&& value) { return emplace(std::move(value)) != NULL; }
+    
+    bool insert_item(int64_t index, T value) {
+        if (index < 0 || index > size_) {
+            return false;
+        }
+        if (size_ == capacity_ && !reserve(grown_capacity())) {
+            return false;
+        }
+        
+        if (std::is_trivially_copyable<T>::value) {
+            memmove((void*)&data_[index + 1], (const void*)&data_[index], sizeof(T) * (size_ - index));
+            new (&data_[index]) T(std::move(value));
+        } else if (index == size_) {
+            new (&data_[size_]) T(std::move(value));
+        } else {
+            new (&data_[size_]) T(std::move(data_[size_ - 1]));
+            for (int64_t i = size_ - 1; i > index; --i) {
+                data_[i] = std::move(data_[i - 1]);
+            }
+            data_[index] = std::move(value);
+        }
+        ++size_;
+        return true;
+    }
+    
+    bool remove_item(int64_t index, T* removed) {
+        if (index < 0 || index >= size_) {
+            return false;
+        }
+        
+        if (removed != NULL) {
+            *removed = std::move(data_[index]);
+        }
+        
+        if (std::is_trivially_copyable<T>::value) {
+            memmove((void*)&data_[index], (const void*)&data_[index + 1], sizeof(T) * (size_ - index - 1));
+            --size_;
+            return true;
+        }
+        
+        for (int64_t i = index; i + 1 < size_; ++i) {
+            data_[i] = std::move(data_[i + 1]);
+        }
+        --size_;
+        data_[size_].~T();
+        return true;
+    }
+    
+    bool resize(int64_t new_size) {
+        if (new_size < 0 || !reserve(new_size)) {
+            return false;
+        }
+        
+        while (size_ > new_size) {
+            --size_;
+            data_[size_].~T();
+        }
+        while (size_ < new_size) {
+            new (&data_[size_]) T();
+            ++size_;
+        }
+        return true;
+    }
+    
+    void clear() {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (int64_t i = 0; i < size_; ++i) {
+                data_[i].~T();
+            }
+        }
+        size_ = 0;
+    }
+    
+    int64_t find(const T& value) const {
+        for (int64_t i = 0; i < size_; ++i) {
+            if (data_[i] == value) {
+                return i;
+            }
+        }
+        return -1;
+    }
+    
+private:
+    T* inline_data() { return reinterpret_cast<T*>(inline_); }
+    
+    const T* inline_data() const { return reinterpret_cast<const T*>(inline_); }
+    
+    int64_t grown_capacity() const {
+        if (capacity_ > INT64_MAX / 2) {
+            return INT64_MAX;
+        }
+        return (capacity_ > 0) ? capacity_ * 2 : 4;
+    }
+    
+    T* allocate(int64_t count) {
+        if (arena_ == NULL) {
+            return (T*)malloc_array(count, sizeof(T));
+        }
+        
+        size_t bytes = 0;
+        return checked_array_bytes(count, sizeof(T), &bytes) ? (T*)arena_alloc(arena_, bytes) : NULL;
+    }
+    
+    void release() {
+        if (!is_inline() && arena_ == NULL) {
+            tracked_free(data_);
+        }
+    }
+    
+    static void relocate(T* from, T* to, int64_t count) {
+        if (std::is_trivially_copyable<T>::value) {
+            if (count > 0) {
+                memcpy((void*)to, (const void*)from, sizeof(T) * count);
+            }
+            return;
+        }
+        
+        for (int64_t i = 0; i < count; ++i) {
+            new (&to[i]) T(std::move(from[i]));
+            from[i].~T();
+        }
+    }
+    
+    void take(ArrayList& other) {
+        arena_ = other.arena_;
+        if (other.is_inline()) {
+            relocate(other.data_, data_, other.size_);
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+        }
+        size_ = other.size_;
+        
+        other.data_ = other.inline_data();
+        other.size_ = 0;
+        other.capacity_ = InlineN;
+    }
+    
+    T* data_;
+    int64_t size_;
+    int64_t capacity_;
+    Arena* arena_;
+    alignas(T) unsigned char inline_[(InlineN > 0 ? InlineN : 1) * sizeof(T)];
+};
+
+template <typename T>
+class Matrix {
+public:
+    Matrix() : rows_(0), cols_(0) {}
+    
+    Matrix(int32_t rows, int32_t cols) : rows_(0), cols_(0) {
+        resize(rows, cols);
+    }
+    
+    Matrix(Matrix&& other) noexcept : values_(std::move(other.values_)), rows_(other.rows_), cols_(other.cols_) {
+        other.rows_ = 0;
+        other.cols_ = 0;
+    }
+    
+    Matrix& operator=(Matrix&& other) noexcept {
+        if (this != &other) {
+            values_ = std::move(other.values_);
+            rows_ = other.rows_;
+            cols_ = other.cols_;
+            other.rows_ = 0;
+            other.cols_ = 0;
+        }
+        return *this;
+    }
+    
+    Matrix(const Matrix&) = delete;
+    
+    Matrix& operator=(const Matrix&) = delete;
+    
+    int32_t rows() const { return rows_; }
+    
+    int32_t cols() const { return cols_; }
+    
+    int64_t size() const { return (int64_t)rows_ * cols_; }
+    
+    T* data() { return values_.data(); }
+    
+    const T* data() const { return values_.data(); }
+    
+    T* row(int32_t index) {
+        DS_CHECK_ACCESS(index >= 0 && index < rows_);
+        return values_.data() + (int64_t)index * cols_;
+    }
+    
+    const T* row(int32_t index) const {
+        DS_CHECK_ACCESS(index >= 0 && index < rows_);
+        return values_.data() + (int64_t)index * cols_;
+    }
+    
+    T& operator()(int32_t row_index, int32_t col_index) {
+        DS_CHECK_ACCESS(row_index >= 0 && row_index < rows_ && col_index >= 0 && col_index < cols_);
+        return values_.data()[(int64_t)row_index * cols_ + col_index];
+    }
+    
+    const T& operator()(int32_t row_index, int32_t col_index) const {
+        DS_CHECK_ACCESS(row_index >= 0 && row_index < rows_ && col_index >= 0 && col_index < cols_);
+        return values_.data()[(int64_t)row_index * cols_ + col_index];
+    }
+    
+    bool reserve(int32_t row_capacity) {
+        return values_.reserve((int64_t)row_capacity * cols_);
+    }
+    
+    bool resize(int32_t rows, int32_t cols) {
+        if (rows < 0 || cols < 0) {
+            return false;
+        }
+        
+        if (cols == cols_ || rows_ == 0) {
+            if (!values_.resize((int64_t)rows * cols)) {
+                return false;
+            }
+            rows_ = rows;
+            cols_ = cols;
+            return true;
+        }
+        
+        ArrayList<T> next;
+        if (!next.reserve((int64_t)rows * cols)) {
+            return false;
+        }
+        for (int32_t i = 0; i < rows; ++i) {
+            for (int32_t j = 0; j < cols; ++j) {
+                if (i < rows_ && j < cols_) {
+                    next.emplace(std::move((*this)(i, j)));
+                } else {
+                    next.emplace();
+                }
+            }
+        }
+        
+        values_ = std::move(next);
+        rows_ = rows;
+        cols_ = cols;
+        return true;
+    }
+    
+    template <typename... Args>
+    T* emplace_row(const Args&... args) {
+        if (values_.size() + cols_ > values_.capacity()
+            && !values_.reserve(((rows_ > 0) ? (int64_t)rows_ * 2 : 4) * cols_)) {
+            return NULL;
+        }
+        
+        for (int32_t j = 0; j < cols_; ++j) {
+            values_.emplace(args...);
+        }
+        ++rows_;
+        return row(rows_ - 1);
+    }
+    
+    void clear() {
+        values_.clear();
+        rows_ = 0;
+    }
+    
+private:
+    ArrayList<T> values_;
+    int32_t rows_;
+    int32_t cols_;
+};
+
+}
+
+#endif
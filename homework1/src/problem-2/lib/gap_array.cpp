@@ -0,0 +1,176 @@
+#include "./gap_array.h"
+
+static int64_t gap_length(GapArrayList* list) {
+    return list->gap_end - list->gap_start;
+}
+
+static void move_gap(GapArrayList* list, int64_t index) {
+    if (index < list->gap_start) {
+        int64_t moved = list->gap_start - index;
+        memmove(&list->arr[list->gap_end - moved], &list->arr[index], sizeof(int32_t) * moved);
+        list->gap_start -= moved;
+        list->gap_end -= moved;
+    } else if (index > list->gap_start) {
+        int64_t moved = index - list->gap_start;
+        memmove(&list->arr[list->gap_start], &list->arr[list->gap_end], sizeof(int32_t) * moved);
+        list->gap_start += moved;
+        list->gap_end += moved;
+    }
+}
+
+GapArrayList* new_gap_list() {
+    GapArrayList* nums = (GapArrayList*)tracked_malloc(sizeof(GapArrayList));
+    if (nums == NULL) {
+        return NULL;
+    }
+    nums->capacity = 10;
+    nums->arr = (int32_t*)malloc_array(nums->capacity, sizeof(int32_t));
+    if (nums->arr == NULL) {
+        tracked_free(nums);
+        return NULL;
+    }
+    nums->gap_start = 0;
+    nums->gap_end = nums->capacity;
+    nums->extend_ratio = 2;
+    return nums;
+}
+
+void delete_list(GapArrayList* list) {
+    if (list != NULL) {
+        tracked_free(list->arr);
+        tracked_free(list);
+    }
+}
+
+void extend_capacity(GapArrayList* list) {
+    if (list == NULL) {
+        return;
+    }
+    
+    int64_t new_capacity = 0;
+    if (!checked_mul_i64(capacity(list), list->extend_ratio, &new_capacity)) {
+        return;
+    }
+    
+    int32_t* extend = (int32_t*)malloc_array(new_capacity, sizeof(int32_t));
+    
+    if (extend == NULL) {
+        return;
+    }
+    
+    int64_t tail = list->capacity - list->gap_end;
+    record_copied_bytes((int64_t)sizeof(int32_t) * (list->gap_start + tail));
+    memcpy(extend, list->arr, sizeof(int32_t) * list->gap_start);
+    memcpy(&extend[new_capacity - tail], &list->arr[list->gap_end], sizeof(int32_t) * tail);
+    
+    tracked_free(list->arr);
+    list->arr = extend;
+    list->gap_end = new_capacity - tail;
+    list->capacity = new_capacity;
+}
+
+int64_t size(GapArrayList* list) {
+    if (list == NULL) return 0;
+    return list->capacity - gap_length(list);
+}
+
+int64_t capacity(GapArrayList* list) {
+    if (list == NULL) return 0;
+    return list->capacity;
+}
+
+int32_t get(GapArrayList* list, int64_t index) {
+    if (list == NULL || index < 0 || index >= size(list)) {
+        return -1;
+    }
+    return (index < list->gap_start) ? list->arr[index] : list->arr[index + gap_length(list)];
+}
+
+void set(GapArrayList* list, int64_t index, int32_t num) {
+    if (list == NULL || index < 0 || index >= size(list)) {
+        return;
+    }
+    if (index < list->gap_start) {
+        list->arr[index] = num;
+    } else {
+        list->arr[index + gap_length(list)] = num;
+    }
+}
+
+void add(GapArrayList* list, int32_t num) {
+    insert_item(list, size(list), num);
+}
+
+void insert_item(GapArrayList* list, int64_t index, int32_t num) {
+    if (list == NULL || index < 0 || index > size(list)) {
+        return;
+    }
+    
+    if (gap_length(list) == 0) {
+        extend_capacity(list);
+        if (gap_length(list) == 0) {
+            return;
+        }
+    }
+    
+    move_gap(list, index);
+    list->arr[list->gap_start] = num;
+    ++list->gap_start;
+}
+
+int32_t remove_item(GapArrayList* list, int64_t index) {
+    if (list == NULL || index < 0 || index >= size(list)) {
+        return -1;
+    }
+    
+    move_gap(list, index);
+    int32_t num = list->arr[list->gap_end];
+    ++list->gap_end;
+    return num;
+}
+
+int32_t* to_array(GapArrayList* list) {
+    if (list == NULL || size(list) == 0) {
+        return NULL;
+    }
+    
+    int32_t* array = (int32_t*)malloc_array(size(list), sizeof(int32_t));
+    if (array == NULL) {
+        return NULL;
+    }
+    
+    memcpy(array, list->arr, sizeof(int32_t) * list->gap_start);
+    memcpy(&array[list->gap_start], &list->arr[list->gap_end], 
+           sizeof(int32_t) * (list->capacity - list->gap_end));
+    return array;
+}
+
+bool is_empty(GapArrayList* list) {
+    return list == NULL || size(list) == 0;
+}
+
+void clear(GapArrayList* list) {
+    if (list != NULL) {
+        list->gap_start = 0;
+        list->gap_end = list->capacity;
+    }
+}
+
+int64_t find(GapArrayList* list, int32_t value) {
+    if (list == NULL) return -1;
+    
+    int64_t index = simd_find_i32(list->arr, list->gap_start, value);
+    if (index >= 0) {
+        return index;
+    }
+    
+    index = simd_find_i32(&list->arr[list->gap_end], list->capacity - list->gap_end, value);
+    return (index >= 0) ? index + list->gap_start : -1;
+}
+
+int64_t count_value(GapArrayList* list, int32_t value) {
+    if (list == NULL) return 0;
+    
+    return simd_count_i32(list->arr, list->gap_start, value)
+        + simd_count_i32(&list->arr[list->gap_end], list->capacity - list->gap_end, value);
+}
@@ -0,0 +1,50 @@
+#ifndef GAP_ARRAY_H
+#define GAP_ARRAY_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "./alloc.h"
+#include "./simd.h"
+
+typedef struct {
+    int32_t *arr;
+    int64_t capacity;
+    int64_t gap_start;
+    int64_t gap_end;
+    int32_t extend_ratio;
+} GapArrayList;
+
+GapArrayList* new_gap_list();
+
+void delete_list(GapArrayList* list);
+
+void extend_capacity(GapArrayList* list);
+
+int64_t size(GapArrayList* list);
+
+int64_t capacity(GapArrayList* list);
+
+int32_t get(GapArrayList* list, int64_t index);
+
+void set(GapArrayList* list, int64_t index, int32_t num);
+
+void add(GapArrayList* list, int32_t num);
+
+void insert_item(GapArrayList* list, int64_t index, int32_t num);
+
+int32_t remove_item(GapArrayList* list, int64_t index);
+
+int32_t* to_array(GapArrayList* list);
+
+bool is_empty(GapArrayList* list);
+
+void clear(GapArrayList* list);
+
+int64_t find(GapArrayList* list, int32_t value);
+
+int64_t count_value(GapArrayList* list, int32_t value);
+
+#endif
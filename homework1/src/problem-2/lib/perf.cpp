@@ -0,0 +1,216 @@
+#include "./perf.h"
+#include <errno.h>
+#include <unistd.h>
+
+#if defined(DS_PERF_COUNTERS) && defined(__linux__)
+#define PERF_EVENTS_SUPPORTED
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+typedef struct {
+    uint32_t type;
+    uint64_t config;
+} PerfEventSpec;
+
+static const PerfEventSpec perf_events[PERF_COUNTER_COUNT] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+        | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS }
+};
+
+static int open_perf_event(const PerfEventSpec* spec) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = spec->type;
+    attr.config = spec->config;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+#endif
+
+static const char* perf_counter_names[PERF_COUNTER_COUNT] = {
+    "cycles", "instructions", "L1d misses", "LLC misses", "branch misses", "page faults"
+};
+
+PerfCounters* new_perf_counters() {
+    PerfCounters* counters = (PerfCounters*)malloc(sizeof(PerfCounters));
+    if (counters == NULL) {
+        return NULL;
+    }
+    
+    counters->error = 0;
+    counters->running = false;
+    
+    for (int32_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+#ifdef PERF_EVENTS_SUPPORTED
+        counters->fds[i] = open_perf_event(&perf_events[i]);
+        if (counters->fds[i] < 0 && counters->error == 0) {
+            counters->error = errno;
+        }
+#else
+        counters->fds[i] = -1;
+        counters->error = ENOSYS;
+#endif
+    }
+    
+    return counters;
+}
+
+void delete_perf_counters(PerfCounters* counters) {
+    if (counters == NULL) {
+        return;
+    }
+    
+    for (int32_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        if (counters->fds[i] >= 0) {
+            close(counters->fds[i]);
+        }
+    }
+    free(counters);
+}
+
+bool perf_counters_available(PerfCounters* counters) {
+    if (counters == NULL) {
+        return false;
+    }
+    
+    for (int32_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        if (counters->fds[i] >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* perf_unavailable_reason(PerfCounters* counters) {
+    if (counters == NULL) {
+        return "not initialized";
+    }
+    
+    switch (counters->error) {
+        case 0:
+            return "none";
+        case EACCES:
+        case EPERM:
+            return "permission denied (check kernel.perf_event_paranoid)";
+        case ENOENT:
+        case EOPNOTSUPP:
+            return "event not supported by this CPU or hypervisor";
+        case ENOSYS:
+            return "built without perf_event_open support";
+        default:
+            return strerror(counters->error);
+    }
+}
+
+const char* perf_counter_name(PerfCounter counter) {
+    if ((int32_t)counter < 0 || counter >= PERF_COUNTER_COUNT) {
+        return "unknown";
+    }
+    return perf_counter_names[counter];
+}
+
+void start_perf_counters(PerfCounters* counters) {
+    if (counters == NULL) {
+        return;
+    }
+    
+#ifdef PERF_EVENTS_SUPPORTED
+    for (int32_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        if (counters->fds[i] >= 0) {
+            ioctl(counters->fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(counters->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+    counters->running = true;
+}
+
+void stop_perf_counters(PerfCounters* counters, PerfSample* sample) {
+    if (sample == NULL) {
+        return;
+    }
+    
+    memset(sample, 0, sizeof(PerfSample));
+    if (counters == NULL || !counters->running) {
+        return;
+    }
+    
+#ifdef PERF_EVENTS_SUPPORTED
+    for (int32_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        if (counters->fds[i] >= 0) {
+            ioctl(counters->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    
+    for (int32_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        uint64_t data[3];
+        if (counters->fds[i] < 0 || read(counters->fds[i], data, sizeof(data)) != (ssize_t)sizeof(data)) {
+            continue;
+        }
+        
+        uint64_t enabled = data[1];
+        uint64_t running = data[2];
+        if (running == 0) {
+            continue;
+        }
+        
+        sample->values[i] = (running < enabled)
+            ? (uint64_t)((double)data[0] * (double)enabled / (double)running)
+            : data[0];
+        sample->available[i] = true;
+        sample->multiplexed = sample->multiplexed || running < enabled;
+    }
+#endif
+    counters->running = false;
+}
+
+bool perf_ipc(const PerfSample* sample, double* ipc) {
+    if (sample == NULL || !sample->available[PERF_CYCLES] || !sample->available[PERF_INSTRUCTIONS]
+        || sample->values[PERF_CYCLES] == 0) {
+        return false;
+    }
+    
+    *ipc = (double)sample->values[PERF_INSTRUCTIONS] / (double)sample->values[PERF_CYCLES];
+    return true;
+}
+
+void print_perf_sample(PerfCounters* counters, const PerfSample* sample) {
+    if (!perf_counters_available(counters) || sample == NULL) {
+        printf("Counters: unavailable (%s)\n", perf_unavailable_reason(counters));
+        return;
+    }
+    
+    printf("Counters:");
+    for (int32_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        if (sample->available[i]) {
+            printf(" %s %llu", perf_counter_names[i], (unsigned long long)sample->values[i]);
+        } else {
+            printf(" %s n/a", perf_counter_names[i]);
+        }
+        
+        double ipc = 0;
+        if (i == PERF_INSTRUCTIONS && perf_ipc(sample, &ipc)) {
+            printf(", IPC %.2f", ipc);
+        }
+        if (i < PERF_COUNTER_COUNT - 1) printf(",");
+    }
+    if (sample->multiplexed) {
+        printf(" (scaled)");
+    }
+    if (counters->error != 0) {
+        printf(" [n/a: %s]", perf_unavailable_reason(counters));
+    }
+    printf("\n");
+}
@@ -0,0 +1,50 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+typedef enum {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_PAGE_FAULTS,
+    PERF_COUNTER_COUNT
+} PerfCounter;
+
+typedef struct {
+    int fds[PERF_COUNTER_COUNT];
+    int error;
+    bool running;
+} PerfCounters;
+
+typedef struct {
+    uint64_t values[PERF_COUNTER_COUNT];
+    bool available[PERF_COUNTER_COUNT];
+    bool multiplexed;
+} PerfSample;
+
+PerfCounters* new_perf_counters();
+
+void delete_perf_counters(PerfCounters* counters);
+
+bool perf_counters_available(PerfCounters* counters);
+
+const char* perf_unavailable_reason(PerfCounters* counters);
+
+const char* perf_counter_name(PerfCounter counter);
+
+void start_perf_counters(PerfCounters* counters);
+
+void stop_perf_counters(PerfCounters* counters, PerfSample* sample);
+
+bool perf_ipc(const PerfSample* sample, double* ipc);
+
+void print_perf_sample(PerfCounters* counters, const PerfSample* sample);
+
+#endif
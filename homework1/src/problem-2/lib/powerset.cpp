@@ -0,0 +1,738 @@
+#include "./powerset.h"
+#include <thread>
+#include <vector>
+
+PowerSetMatrix* new_powerset_matrix(int64_t max_subsets, int32_t max_elements, bool fill_padding) {
+    if (max_subsets <= 0 || max_subsets > INT32_MAX) {
+        return NULL;
+    }
+    
+    PowerSetMatrix* ps = (PowerSetMatrix*)tracked_malloc(sizeof(PowerSetMatrix));
+    if (ps == NULL) {
+        return NULL;
+    }
+    
+    ps->storage = POWERSET_MATRIX;
+    ps->masks = NULL;
+    ps->values = NULL;
+    ps->offsets = NULL;
+    ps->value_capacity = 0;
+    ps->base_set = NULL;
+    ps->base_size = 0;
+    ps->max_subsets = max_subsets;
+    
+    ps->matrix = new_matrix((int32_t)max_subsets, max_elements);
+    if (ps->matrix == NULL) {
+        tracked_free(ps);
+        return NULL;
+    }
+    
+    ps->subset_sizes = (int32_t*)calloc_array(max_subsets, sizeof(int32_t));
+    if (ps->subset_sizes == NULL) {
+        delete_matrix(ps->matrix);
+        tracked_free(ps);
+        return NULL;
+    }
+    
+    ps->subset_count = 0;
+    ps->max_subset_size = max_elements;
+    
+    if (fill_padding) {
+        fill_matrix(ps->matrix, -1);
+    }
+    
+    return ps;
+}
+
+PowerSetMatrix* new_powerset_mask(int64_t max_subsets, int32_t* set, int32_t set_size) {
+    if (max_subsets <= 0 || set_size < 0 || set_size > MAX_MASK_ELEMENTS) {
+        return NULL;
+    }
+    
+    PowerSetMatrix* ps = (PowerSetMatrix*)tracked_malloc(sizeof(PowerSetMatrix));
+    if (ps == NULL) {
+        return NULL;
+    }
+    
+    ps->storage = POWERSET_MASK;
+    ps->matrix = NULL;
+    ps->subset_sizes = NULL;
+    ps->values = NULL;
+    ps->offsets = NULL;
+    ps->value_capacity = 0;
+    ps->subset_count = 0;
+    ps->max_subsets = max_subsets;
+    ps->max_subset_size = set_size;
+    ps->base_size = set_size;
+    
+    ps->masks = (SubsetMask*)malloc_array(max_subsets, sizeof(SubsetMask));
+    if (ps->masks == NULL) {
+        tracked_free(ps);
+        return NULL;
+    }
+    
+    ps->base_set = (int32_t*)malloc_array(set_size, sizeof(int32_t));
+    if (ps->base_set == NULL) {
+        tracked_free(ps->masks);
+        tracked_free(ps);
+        return NULL;
+    }
+    
+    if (set_size > 0) {
+        memcpy(ps->base_set, set, sizeof(int32_t) * set_size);
+    }
+    
+    return ps;
+}
+
+int64_t powerset_value_count(int32_t set_size) {
+    int64_t total = 0;
+    int64_t binomial = 1;
+    
+    for (int32_t k = 1; k <= set_size; ++k) {
+        binomial = binomial * (set_size - k + 1) / k;
+        total += k * binomial;
+    }
+    
+    return total;
+}
+
+PowerSetMatrix* new_powerset_csr(int64_t max_subsets, int32_t set_size) {
+    if (max_subsets <= 0 || max_subsets == INT64_MAX || set_size < 0) {
+        return NULL;
+    }
+    
+    PowerSetMatrix* ps = (PowerSetMatrix*)tracked_malloc(sizeof(PowerSetMatrix));
+    if (ps == NULL) {
+        return NULL;
+    }
+    
+    ps->storage = POWERSET_CSR;
+    ps->matrix = NULL;
+    ps->subset_sizes = NULL;
+    ps->masks = NULL;
+    ps->base_set = NULL;
+    ps->base_size = 0;
+    ps->subset_count = 0;
+    ps->max_subsets = max_subsets;
+    ps->max_subset_size = set_size;
+    ps->value_capacity = powerset_value_count(set_size);
+    
+    ps->values = (int32_t*)malloc_array(ps->value_capacity, sizeof(int32_t));
+    if (ps->values == NULL) {
+        tracked_free(ps);
+        return NULL;
+    }
+    
+    ps->offsets = (int64_t*)malloc_array(max_subsets + 1, sizeof(int64_t));
+    if (ps->offsets == NULL) {
+        tracked_free(ps->values);
+        tracked_free(ps);
+        return NULL;
+    }
+    
+    ps->offsets[0] = 0;
+    
+    return ps;
+}
+
+PowerSetMatrix* new_powerset_storage(PowerSetStorage storage, int64_t max_subsets, int32_t* set, int32_t set_size, bool fill_padding) {
+    switch (storage) {
+        case POWERSET_MASK:
+            return new_powerset_mask(max_subsets, set, set_size);
+        case POWERSET_CSR:
+            return new_powerset_csr(max_subsets, set_size);
+        default:
+            return new_powerset_matrix(max_subsets, set_size > 0 ? set_size : 1, fill_padding);
+    }
+}
+
+const char* powerset_storage_name(PowerSetStorage storage) {
+    switch (storage) {
+        case POWERSET_MASK:
+            return "mask";
+        case POWERSET_CSR:
+            return "csr";
+        default:
+            return "matrix";
+    }
+}
+
+void delete_powerset_matrix(PowerSetMatrix* ps) {
+    if (ps == NULL) {
+        return;
+    }
+    
+    delete_matrix(ps->matrix);
+    tracked_free(ps->subset_sizes);
+    tracked_free(ps->masks);
+    tracked_free(ps->values);
+    tracked_free(ps->offsets);
+    tracked_free(ps->base_set);
+    tracked_free(ps);
+}
+
+int32_t get_subset_size(PowerSetMatrix* ps, int64_t subset_index) {
+    if (ps == NULL || subset_index < 0 || subset_index >= ps->subset_count) {
+        return 0;
+    }
+    
+    if (ps->storage == POWERSET_MASK) {
+        return __builtin_popcount(ps->masks[subset_index]);
+    }
+    
+    if (ps->storage == POWERSET_CSR) {
+        return (int32_t)(ps->offsets[subset_index + 1] - ps->offsets[subset_index]);
+    }
+    
+    return ps->subset_sizes[subset_index];
+}
+
+int32_t get_subset_element(PowerSetMatrix* ps, int64_t subset_index, int32_t position) {
+    if (ps == NULL || subset_index < 0 || subset_index >= ps->subset_count || position < 0) {
+        return -1;
+    }
+    
+    if (ps->storage == POWERSET_MASK) {
+        SubsetMask mask = ps->masks[subset_index];
+        for (int32_t i = 0; i < position && mask != 0; ++i) {
+            mask &= mask - 1;
+        }
+        
+        if (mask == 0) {
+            return -1;
+        }
+        
+        return ps->base_set[__builtin_ctz(mask)];
+    }
+    
+    if (position >= get_subset_size(ps, subset_index)) {
+        return -1;
+    }
+    
+    if (ps->storage == POWERSET_CSR) {
+        return ps->values[ps->offsets[subset_index] + position];
+    }
+    
+    return matrix_at(ps->matrix, (int32_t)subset_index, position);
+}
+
+void add_mask_to_powerset(PowerSetMatrix* ps, SubsetMask mask) {
+    if (ps == NULL || ps->storage != POWERSET_MASK || ps->subset_count >= ps->max_subsets) {
+        return;
+    }
+    
+    ps->masks[ps->subset_count] = mask;
+    ps->subset_count++;
+}
+
+void add_subset_to_powerset(PowerSetMatrix* ps, int32_t* subset, int32_t size) {
+    if (ps == NULL || ps->storage == POWERSET_MASK || ps->subset_count >= ps->max_subsets) {
+        return;
+    }
+    
+    if (ps->storage == POWERSET_CSR) {
+        int64_t offset = ps->offsets[ps->subset_count];
+        if (offset + size > ps->value_capacity) {
+            return;
+        }
+        
+        if (size > 0) {
+            memcpy(&ps->values[offset], subset, sizeof(int32_t) * size);
+        }
+        ps->offsets[ps->subset_count + 1] = offset + size;
+        ps->subset_count++;
+        return;
+    }
+    
+    if (size > ps->matrix->cols) {
+        int32_t old_cols = ps->matrix->cols;
+        extend_matrix(ps->matrix, ps->matrix->rows, size);
+        ps->max_subset_size = size;
+        fill_row_range(ps->matrix, 0, ps->matrix->rows, old_cols, ps->matrix->cols, -1);
+    }
+    
+    if (!set_row_values(ps->matrix, (int32_t)ps->subset_count, 0, subset, size)) {
+        return;
+    }
+    
+    ps->subset_sizes[ps->subset_count] = size;
+    ps->subset_count++;
+}
+
+int32_t* get_subset_from_powerset(PowerSetMatrix* ps, int64_t subset_index, int32_t* size) {
+    if (ps == NULL || subset_index < 0 || subset_index >= ps->subset_count) {
+        *size = 0;
+        return NULL;
+    }
+    
+    *size = get_subset_size(ps, subset_index);
+    if (*size == 0) {
+        return NULL;
+    }
+    
+    int32_t* subset = (int32_t*)malloc_array(*size, sizeof(int32_t));
+    if (subset == NULL) {
+        *size = 0;
+        return NULL;
+    }
+    
+    if (ps->storage == POWERSET_MASK) {
+        SubsetMask mask = ps->masks[subset_index];
+        for (int32_t i = 0; mask != 0; ++i, mask &= mask - 1) {
+            subset[i] = ps->base_set[__builtin_ctz(mask)];
+        }
+        return subset;
+    }
+    
+    if (ps->storage == POWERSET_CSR) {
+        memcpy(subset, &ps->values[ps->offsets[subset_index]], sizeof(int32_t) * (*size));
+        return subset;
+    }
+    
+    get_row_values(ps->matrix, (int32_t)subset_index, 0, subset, *size);
+    
+    return subset;
+}
+
+SubsetView get_subset_view(PowerSetMatrix* ps, int64_t subset_index) {
+    SubsetView view = { NULL, 0 };
+    
+    if (ps == NULL || subset_index < 0 || subset_index >= ps->subset_count) {
+        return view;
+    }
+    
+    view.size = get_subset_size(ps, subset_index);
+    
+    if (ps->storage == POWERSET_CSR) {
+        view.data = &ps->values[ps->offsets[subset_index]];
+    } else if (ps->storage == POWERSET_MATRIX) {
+        view.data = get_row_pointer(ps->matrix, (int32_t)subset_index);
+    }
+    
+    return view;
+}
+
+void add_subset_with_prefix(PowerSetMatrix* ps, int32_t prefix, SubsetView view) {
+    if (ps == NULL || ps->storage == POWERSET_MASK || ps->subset_count >= ps->max_subsets) {
+        return;
+    }
+    
+    int32_t size = view.size + 1;
+    int32_t* row;
+    
+    if (ps->storage == POWERSET_CSR) {
+        int64_t offset = ps->offsets[ps->subset_count];
+        if (offset + size > ps->value_capacity) {
+            return;
+        }
+        
+        row = &ps->values[offset];
+        ps->offsets[ps->subset_count + 1] = offset + size;
+    } else {
+        if (size > ps->matrix->cols) {
+            return;
+        }
+        
+        row = get_row_pointer(ps->matrix, (int32_t)ps->subset_count);
+        ps->subset_sizes[ps->subset_count] = size;
+    }
+    
+    row[0] = prefix;
+    if (view.size > 0) {
+        memcpy(&row[1], view.data, sizeof(int32_t) * view.size);
+    }
+    
+    ps->subset_count++;
+}
+
+static void powerset_mask_recursive_helper(PowerSetMatrix* result, int32_t offset, int32_t set_size) {
+    if (set_size == 0) {
+        add_mask_to_powerset(result, 0);
+        return;
+    }
+    
+    powerset_mask_recursive_helper(result, offset + 1, set_size - 1);
+    
+    int64_t current_count = result->subset_count;
+    SubsetMask bit = (SubsetMask)1 << offset;
+    
+    for (int64_t i = 0; i < current_count; ++i) {
+        add_mask_to_powerset(result, result->masks[i] | bit);
+    }
+}
+
+static void powerset_matrix_recursive_helper(PowerSetMatrix* result, int32_t* set, int32_t set_size) {
+    if (set_size == 0) {
+        add_subset_to_powerset(result, NULL, 0);
+        return;
+    }
+    
+    powerset_matrix_recursive_helper(result, set + 1, set_size - 1);
+    
+    int64_t current_count = result->subset_count;
+    
+    for (int64_t i = 0; i < current_count; ++i) {
+        add_subset_with_prefix(result, set[0], get_subset_view(result, i));
+    }
+}
+
+PowerSetMatrix* powerset_matrix_recursive(int32_t* set, int32_t set_size, PowerSetStorage storage) {
+    if (set_size < 0 || set_size > MAX_MASK_ELEMENTS) {
+        return NULL;
+    }
+    
+    int64_t total_subsets = (int64_t)1 << set_size;
+    
+    if (storage == POWERSET_MASK) {
+        PowerSetMatrix* result = new_powerset_mask(total_subsets, set, set_size);
+        if (result == NULL) {
+            return NULL;
+        }
+        
+        powerset_mask_recursive_helper(result, 0, set_size);
+        
+        return result;
+    }
+    
+    PowerSetMatrix* result = new_powerset_storage(storage, total_subsets, set, set_size);
+    if (result == NULL) {
+        return NULL;
+    }
+    
+    powerset_matrix_recursive_helper(result, set, set_size);
+    
+    return result;
+}
+
+static void powerset_block_doubling_helper(PowerSetMatrix* result, int32_t* set, int32_t set_size) {
+    if (set_size == 0) {
+        add_subset_to_powerset(result, NULL, 0);
+        return;
+    }
+    
+    powerset_block_doubling_helper(result, set + 1, set_size - 1);
+    
+    int64_t current_count = result->subset_count;
+    
+    if (result->storage == POWERSET_CSR) {
+        int64_t* offsets = result->offsets;
+        int32_t* values = &result->values[offsets[current_count]];
+        
+        for (int64_t i = 0; i < current_count; ++i) {
+            int64_t size = offsets[i + 1] - offsets[i];
+            *values++ = set[0];
+            memcpy(values, &result->values[offsets[i]], sizeof(int32_t) * size);
+            values += size;
+            offsets[current_count + i + 1] = offsets[current_count] + offsets[i + 1] + i + 1;
+        }
+    } else {
+        MatrixList* matrix = result->matrix;
+        int32_t* source = get_row_pointer(matrix, 0);
+        int32_t* target = get_row_pointer(matrix, (int32_t)current_count);
+        
+        if (source != NULL && target != NULL && matrix->cols > 1) {
+            int64_t stride = matrix->col_capacity;
+            memcpy(&target[1], source, sizeof(int32_t) * ((current_count - 1) * stride + matrix->cols - 1));
+            for (int64_t i = 0; i < current_count; ++i) {
+                target[i * stride] = set[0];
+            }
+        } else {
+            copy_row_block(matrix, 0, (int32_t)current_count, (int32_t)current_count, 1);
+            fill_row_range(matrix, (int32_t)current_count, (int32_t)(2 * current_count), 0, 1, set[0]);
+        }
+        
+        for (int64_t i = 0; i < current_count; ++i) {
+            result->subset_sizes[current_count + i] = result->subset_sizes[i] + 1;
+        }
+    }
+    
+    result->subset_count = 2 * current_count;
+}
+
+PowerSetMatrix* powerset_matrix_block_doubling(int32_t* set, int32_t set_size, PowerSetStorage storage) {
+    if (set_size < 0 || set_size > MAX_MASK_ELEMENTS) {
+        return NULL;
+    }
+    
+    int64_t total_subsets = (int64_t)1 << set_size;
+    
+    PowerSetMatrix* result = new_powerset_storage(storage, total_subsets, set, set_size);
+    if (result == NULL) {
+        return NULL;
+    }
+    
+    if (storage == POWERSET_MASK) {
+        powerset_mask_recursive_helper(result, 0, set_size);
+    } else {
+        powerset_block_doubling_helper(result, set, set_size);
+    }
+    
+    return result;
+}
+
+PowerSetMatrix* powerset_matrix_iterative(int32_t* set, int32_t set_size, PowerSetStorage storage) {
+    if (set_size < 0 || set_size > MAX_MASK_ELEMENTS) {
+        return NULL;
+    }
+    
+    int64_t total_subsets = (int64_t)1 << set_size;
+    
+    if (storage == POWERSET_MASK) {
+        PowerSetMatrix* result = new_powerset_mask(total_subsets, set, set_size);
+        if (result == NULL) {
+            return NULL;
+        }
+        
+        for (int64_t mask = 0; mask < total_subsets; mask++) {
+            add_mask_to_powerset(result, (SubsetMask)mask);
+        }
+        
+        return result;
+    }
+    
+    PowerSetMatrix* result = new_powerset_storage(storage, total_subsets, set, set_size);
+    if (result == NULL) {
+        return NULL;
+    }
+    
+    ds::ArrayList<int32_t, MAX_MASK_ELEMENTS> temp_subset;
+    
+    for (int64_t mask = 0; mask < total_subsets; mask++) {
+        temp_subset.clear();
+        
+        for (int32_t i = 0; i < set_size; ++i) {
+            if (mask & ((int64_t)1 << i)) {
+                temp_subset.add(set[i]);
+            }
+        }
+        
+        add_subset_to_powerset(result, temp_subset.data(), (int32_t)temp_subset.size());
+    }
+    
+    return result;
+}
+
+static int64_t popcount_prefix(int64_t limit, int32_t set_size) {
+    int64_t total = 0;
+    for (int32_t i = 0; i < set_size; ++i) {
+        int64_t period = (int64_t)1 << (i + 1);
+        int64_t half = (int64_t)1 << i;
+        int64_t tail = limit % period - half;
+        total += (limit / period) * half + (tail > 0 ? tail : 0);
+    }
+    return total;
+}
+
+static void powerset_iterative_worker(PowerSetMatrix* result, int32_t* set, int32_t set_size, int64_t begin, int64_t end) {
+    int64_t offset = 0;
+    if (result->storage == POWERSET_CSR) {
+        offset = popcount_prefix(begin, set_size);
+    }
+    
+    for (int64_t mask = begin; mask < end; ++mask) {
+        if (result->storage == POWERSET_MASK) {
+            result->masks[mask] = (SubsetMask)mask;
+            continue;
+        }
+        
+        if (result->storage == POWERSET_CSR) {
+            int32_t* values = &result->values[offset];
+            for (int32_t i = 0; i < set_size; ++i) {
+                if (mask & ((int64_t)1 << i)) {
+                    *values++ = set[i];
+                }
+            }
+            offset += __builtin_popcountll(mask);
+            result->offsets[mask + 1] = offset;
+            continue;
+        }
+        
+        int32_t values[MAX_MASK_ELEMENTS];
+        int32_t count = 0;
+        for (int32_t i = 0; i < set_size; ++i) {
+            if (mask & ((int64_t)1 << i)) {
+                values[count++] = set[i];
+            }
+        }
+        for (int32_t i = count; i < result->matrix->cols; ++i) {
+            values[i] = -1;
+        }
+        set_row_values(result->matrix, (int32_t)mask, 0, values, result->matrix->cols);
+        result->subset_sizes[mask] = count;
+    }
+}
+
+PowerSetMatrix* powerset_matrix_iterative_parallel(int32_t* set, int32_t set_size, int32_t thread_count, PowerSetStorage storage) {
+    if (set_size < 0 || set_size > MAX_MASK_ELEMENTS) {
+        return NULL;
+    }
+    
+    int64_t total_subsets = (int64_t)1 << set_size;
+    PowerSetMatrix* result = new_powerset_storage(storage, total_subsets, set, set_size, false);
+    if (result == NULL) {
+        return NULL;
+    }
+    
+    if (thread_count <= 0) {
+        thread_count = (int32_t)std::thread::hardware_concurrency();
+        if (thread_count <= 0) thread_count = 1;
+    }
+    if (thread_count > total_subsets) {
+        thread_count = (int32_t)total_subsets;
+    }
+    
+    int64_t chunk = total_subsets / thread_count;
+    int64_t remainder = total_subsets % thread_count;
+    std::vector<std::thread> workers;
+    workers.reserve(thread_count - 1);
+    
+    int64_t begin = 0;
+    for (int32_t t = 0; t < thread_count; ++t) {
+        int64_t end = begin + chunk + (t < remainder ? 1 : 0);
+        if (t == thread_count - 1) {
+            powerset_iterative_worker(result, set, set_size, begin, end);
+        } else {
+            workers.emplace_back(powerset_iterative_worker, result, set, set_size, begin, end);
+        }
+        begin = end;
+    }
+    
+    for (size_t t = 0; t < workers.size(); ++t) {
+        workers[t].join();
+    }
+    
+    result->subset_count = total_subsets;
+    
+    return result;
+}
+
+PowerSetIterator* new_powerset_iterator(int32_t* set, int32_t set_size) {
+    if (set_size < 0 || set_size > MAX_GRAY_ELEMENTS || (set == NULL && set_size > 0)) {
+        return NULL;
+    }
+    
+    PowerSetIterator* it = (PowerSetIterator*)tracked_malloc(sizeof(PowerSetIterator));
+    if (it == NULL) {
+        return NULL;
+    }
+    
+    it->set = set;
+    it->set_size = set_size;
+    it->index = 0;
+    it->total = (uint64_t)1 << set_size;
+    it->mask = 0;
+    it->subset_size = 0;
+    it->changed_element = -1;
+    it->added = false;
+    
+    return it;
+}
+
+void delete_powerset_iterator(PowerSetIterator* it) {
+    if (it != NULL) {
+        tracked_free(it);
+    }
+}
+
+const int32_t* current_subset(PowerSetIterator* it, int32_t* size) {
+    if (it == NULL) {
+        *size = 0;
+        return NULL;
+    }
+    
+    *size = it->subset_size;
+    return it->subset;
+}
+
+bool next_subset(PowerSetIterator* it) {
+    if (it == NULL || it->index + 1 >= it->total) {
+        return false;
+    }
+    
+    ++it->index;
+    int32_t bit = __builtin_ctzll(it->index);
+    uint64_t flag = (uint64_t)1 << bit;
+    int32_t position = __builtin_popcountll(it->mask & (flag - 1));
+    
+    it->mask ^= flag;
+    it->changed_element = it->set[bit];
+    it->added = (it->mask & flag) != 0;
+    
+    if (it->added) {
+        memmove(&it->subset[position + 1], &it->subset[position],
+                sizeof(int32_t) * (it->subset_size - position));
+        it->subset[position] = it->set[bit];
+        ++it->subset_size;
+    } else {
+        memmove(&it->subset[position], &it->subset[position + 1],
+                sizeof(int32_t) * (it->subset_size - position - 1));
+        --it->subset_size;
+    }
+    
+    return true;
+}
+
+int64_t visit_powerset_gray(int32_t* set, int32_t set_size, SubsetVisitor visitor, void* context) {
+    PowerSetIterator* it = new_powerset_iterator(set, set_size);
+    if (it == NULL || visitor == NULL) {
+        delete_powerset_iterator(it);
+        return 0;
+    }
+    
+    int64_t visited = 0;
+    
+    do {
+        ++visited;
+        if (!visitor(it->subset, it->subset_size, context)) {
+            break;
+        }
+    } while (next_subset(it));
+    
+    delete_powerset_iterator(it);
+    return visited;
+}
+
+void print_powerset_matrix(PowerSetMatrix* ps) {
+    OutputWriter* writer = new_output_writer(stdout);
+    write_powerset_matrix(ps, writer);
+    delete_output_writer(writer);
+}
+
+void write_powerset_matrix(PowerSetMatrix* ps, OutputWriter* writer) {
+    if (writer == NULL) {
+        return;
+    }
+    
+    if (ps == NULL) {
+        write_string(writer, "NULL PowerSet\n");
+        return;
+    }
+    
+    write_string(writer, "PowerSet with ");
+    write_int64(writer, ps->subset_count);
+    write_string(writer, " subsets:\n");
+    write_string(writer, "{ ");
+    
+    for (int64_t i = 0; i < ps->subset_count; ++i) {
+        write_char(writer, '{');
+        
+        if (ps->storage == POWERSET_MASK) {
+            for (SubsetMask mask = ps->masks[i]; mask != 0; mask &= mask - 1) {
+                write_int32(writer, ps->base_set[__builtin_ctz(mask)]);
+                if ((mask & (mask - 1)) != 0) write_char(writer, ',');
+            }
+        } else {
+            SubsetView view = get_subset_view(ps, i);
+            for (int32_t j = 0; j < view.size; ++j) {
+                write_int32(writer, view.data[j]);
+                if (j < view.size - 1) write_char(writer, ',');
+            }
+        }
+        
+        write_char(writer, '}');
+        if (i < ps->subset_count - 1) write_string(writer, ", ");
+    }
+    
+    write_string(writer, " }\n");
+}
@@ -0,0 +1,108 @@
+#ifndef POWERSET_H
+#define POWERSET_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "./matrix.h"
+#include "./array.h"
+
+#define MAX_MASK_ELEMENTS 32
+
+typedef uint32_t SubsetMask;
+
+typedef enum {
+    POWERSET_MATRIX,
+    POWERSET_MASK,
+    POWERSET_CSR
+} PowerSetStorage;
+
+typedef struct {
+    PowerSetStorage storage;
+    MatrixList* matrix;
+    int32_t* subset_sizes;
+    SubsetMask* masks;
+    int32_t* values;
+    int64_t* offsets;
+    int64_t value_capacity;
+    int32_t* base_set;
+    int32_t base_size;
+    int64_t subset_count;
+    int64_t max_subsets;
+    int32_t max_subset_size;
+} PowerSetMatrix;
+
+typedef struct {
+    const int32_t* data;
+    int32_t size;
+} SubsetView;
+
+#define MAX_GRAY_ELEMENTS 63
+
+typedef struct {
+    int32_t* set;
+    int32_t set_size;
+    uint64_t index;
+    uint64_t total;
+    uint64_t mask;
+    int32_t subset[MAX_GRAY_ELEMENTS];
+    int32_t subset_size;
+    int32_t changed_element;
+    bool added;
+} PowerSetIterator;
+
+typedef bool (*SubsetVisitor)(const int32_t* subset, int32_t size, void* context);
+
+PowerSetMatrix* new_powerset_matrix(int64_t max_subsets, int32_t max_elements, bool fill_padding = true);
+
+PowerSetMatrix* new_powerset_mask(int64_t max_subsets, int32_t* set, int32_t set_size);
+
+int64_t powerset_value_count(int32_t set_size);
+
+PowerSetMatrix* new_powerset_csr(int64_t max_subsets, int32_t set_size);
+
+PowerSetMatrix* new_powerset_storage(PowerSetStorage storage, int64_t max_subsets, int32_t* set, int32_t set_size, bool fill_padding = true);
+
+const char* powerset_storage_name(PowerSetStorage storage);
+
+void delete_powerset_matrix(PowerSetMatrix* ps);
+
+int32_t get_subset_size(PowerSetMatrix* ps, int64_t subset_index);
+
+int32_t get_subset_element(PowerSetMatrix* ps, int64_t subset_index, int32_t position);
+
+void add_mask_to_powerset(PowerSetMatrix* ps, SubsetMask mask);
+
+void add_subset_to_powerset(PowerSetMatrix* ps, int32_t* subset, int32_t size);
+
+int32_t* get_subset_from_powerset(PowerSetMatrix* ps, int64_t subset_index, int32_t* size);
+
+SubsetView get_subset_view(PowerSetMatrix* ps, int64_t subset_index);
+
+void add_subset_with_prefix(PowerSetMatrix* ps, int32_t prefix, SubsetView view);
+
+PowerSetMatrix* powerset_matrix_recursive(int32_t* set, int32_t set_size, PowerSetStorage storage = POWERSET_MATRIX);
+
+PowerSetMatrix* powerset_matrix_block_doubling(int32_t* set, int32_t set_size, PowerSetStorage storage = POWERSET_MATRIX);
+
+PowerSetMatrix* powerset_matrix_iterative(int32_t* set, int32_t set_size, PowerSetStorage storage = POWERSET_MATRIX);
+
+PowerSetMatrix* powerset_matrix_iterative_parallel(int32_t* set, int32_t set_size, int32_t thread_count, PowerSetStorage storage = POWERSET_MATRIX);
+
+PowerSetIterator* new_powerset_iterator(int32_t* set, int32_t set_size);
+
+void delete_powerset_iterator(PowerSetIterator* it);
+
+const int32_t* current_subset(PowerSetIterator* it, int32_t* size);
+
+bool next_subset(PowerSetIterator* it);
+
+int64_t visit_powerset_gray(int32_t* set, int32_t set_size, SubsetVisitor visitor, void* context);
+
+void print_powerset_matrix(PowerSetMatrix* ps);
+
+void write_powerset_matrix(PowerSetMatrix* ps, OutputWriter* writer);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+typedef enum {
+    SIMD_SCALAR,
+    SIMD_SSE2,
+    SIMD_AVX2
+} SimdBackend;
+
+SimdBackend simd_detect_backend();
+
+SimdBackend simd_backend();
+
+bool simd_set_backend(SimdBackend backend);
+
+const char* simd_backend_name(SimdBackend backend);
+
+int64_t simd_find_i32(const int32_t* data, int64_t count, int32_t value);
+
+int64_t simd_count_i32(const int32_t* data, int64_t count, int32_t value);
+
+void simd_fill_i32(int32_t* data, int64_t count, int32_t value);
+
+int32_t simd_min_i32(const int32_t* data, int64_t count);
+
+int32_t simd_max_i32(const int32_t* data, int64_t count);
+
+int64_t simd_sum_i32(const int32_t* data, int64_t count);
+
+#endif
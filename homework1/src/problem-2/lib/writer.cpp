@@ -0,0 +1,126 @@
+#include "./writer.h"
+#include <charconv>
+
+OutputWriter* new_output_writer(FILE* file, size_t capacity) {
+    if (file == NULL || capacity < MAX_INT32_CHARS * 2) {
+        return NULL;
+    }
+    
+    OutputWriter* writer = (OutputWriter*)malloc(sizeof(OutputWriter));
+    if (writer == NULL) {
+        return NULL;
+    }
+    
+    writer->buffer = (char*)malloc(capacity);
+    if (writer->buffer == NULL) {
+        free(writer);
+        return NULL;
+    }
+    
+    writer->file = file;
+    writer->capacity = capacity;
+    writer->length = 0;
+    writer->written = 0;
+    writer->failed = false;
+    return writer;
+}
+
+bool delete_output_writer(OutputWriter* writer) {
+    if (writer == NULL) {
+        return false;
+    }
+    
+    bool flushed = flush_output(writer);
+    free(writer->buffer);
+    free(writer);
+    return flushed;
+}
+
+bool flush_output(OutputWriter* writer) {
+    if (writer == NULL) {
+        return false;
+    }
+    
+    if (writer->length > 0 && !writer->failed) {
+        if (fwrite(writer->buffer, 1, writer->length, writer->file) != writer->length) {
+            writer->failed = true;
+        }
+    }
+    writer->written += (int64_t)writer->length;
+    writer->length = 0;
+    return !writer->failed;
+}
+
+static char* reserve_output(OutputWriter* writer, size_t length) {
+    if (writer->length + length > writer->capacity) {
+        flush_output(writer);
+    }
+    return &writer->buffer[writer->length];
+}
+
+void write_bytes(OutputWriter* writer, const char* data, size_t length) {
+    if (writer == NULL || length == 0) {
+        return;
+    }
+    
+    if (length > writer->capacity) {
+        flush_output(writer);
+        if (!writer->failed && fwrite(data, 1, length, writer->file) != length) {
+            writer->failed = true;
+        }
+        writer->written += (int64_t)length;
+        return;
+    }
+    
+    memcpy(reserve_output(writer, length), data, length);
+    writer->length += length;
+}
+
+void write_string(OutputWriter* writer, const char* text) {
+    if (text != NULL) {
+        write_bytes(writer, text, strlen(text));
+    }
+}
+
+void write_char(OutputWriter* writer, char c) {
+    if (writer == NULL) {
+        return;
+    }
+    
+    *reserve_output(writer, 1) = c;
+    ++writer->length;
+}
+
+void write_int32(OutputWriter* writer, int32_t value) {
+    if (writer == NULL) {
+        return;
+    }
+    
+    char* out = reserve_output(writer, MAX_INT32_CHARS);
+    char* end = std::to_chars(out, out + MAX_INT32_CHARS, value).ptr;
+    writer->length += (size_t)(end - out);
+}
+
+void write_int64(OutputWriter* writer, int64_t value) {
+    if (writer == NULL) {
+        return;
+    }
+    
+    char* out = reserve_output(writer, MAX_INT64_CHARS);
+    char* end = std::to_chars(out, out + MAX_INT64_CHARS, value).ptr;
+    writer->length += (size_t)(end - out);
+}
+
+void write_int32_padded(OutputWriter* writer, int32_t value, int32_t width) {
+    if (writer == NULL) {
+        return;
+    }
+    
+    char digits[MAX_INT32_CHARS];
+    int32_t length = (int32_t)(std::to_chars(digits, digits + MAX_INT32_CHARS, value).ptr - digits);
+    
+    for (int32_t i = length; i < width; ++i) {
+        write_char(writer, ' ');
+    }
+    write_bytes(writer, digits, (size_t)length);
+}